@@ -0,0 +1,182 @@
+/********************************************************************************
+ * @brief Implementation details for the ArxModel class.
+ ********************************************************************************/
+#include <arx_model.hpp>
+#include <matrix.hpp>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The ring buffers hold each value twice and the weights hold one
+ *           weight per input and output, so all memory is allocated here once.
+ *        2. An order of 0 is raised to 1, since the model needs an input.
+ *        3. The order is set to 0 if the memory couldn't be allocated, in which
+ *           case the model only predicts its bias.
+ ********************************************************************************/
+ArxModel::ArxModel(const size_t order) : order_{order > 0 ? order : 1} {
+    if (!inputs_.values.Resize(2 * order_) || !outputs_.values.Resize(2 * order_) ||
+        !weights_.Resize(2 * order_)) {
+        inputs_.values.Clear();
+        outputs_.values.Clear();
+        weights_.Clear();
+        order_ = 0;
+    }
+    for (auto& weight : weights_) {
+        weight = 0.0;
+    }
+    Reset();
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Every stored value is overwritten and the heads are reset.
+ ********************************************************************************/
+void ArxModel::Reset(const double input, const double output) {
+    for (auto& value : inputs_.values) {
+        value = input;
+    }
+    for (auto& value : outputs_.values) {
+        value = output;
+    }
+    inputs_.head = outputs_.head = 0;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The input is added first, since the prediction of y[t] depends on
+ *           x[t], but only on the outputs up to y[t - 1].
+ *        2. The prediction is added to the output history afterwards.
+ ********************************************************************************/
+double ArxModel::Update(const double input) {
+    if (order_ == 0) return bias_;
+    inputs_.Push(input, order_);
+    const auto prediction{Predict(inputs_.Window(), 1, outputs_.Window(), 1)};
+    outputs_.Push(prediction, order_);
+    return prediction;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Same as Update(input), but the measured output is added to the
+ *           output history instead of the prediction.
+ ********************************************************************************/
+double ArxModel::Update(const double input, const double output) {
+    if (order_ == 0) return bias_;
+    inputs_.Push(input, order_);
+    const auto prediction{Predict(inputs_.Window(), 1, outputs_.Window(), 1)};
+    outputs_.Push(output, order_);
+    return prediction;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Sample t (k <= t < num_samples) is one training set, whose features
+ *           are x[t] - x[t - k + 1] and y[t - 1] - y[t - k]. They are read via
+ *           pointers into the trace, which slide one sample per set.
+ *        2. The features and outputs are centered around their means, so the
+ *           bias can be calculated afterwards. The covariances between all
+ *           features (G) and between each feature and the output (c) are summed
+ *           in one pass over the sets.
+ *        3. The normal equations (G + lambda * I) * w = c are solved via
+ *           Cholesky decomposition, since the matrix is symmetric positive
+ *           definite unless the features are linearly dependent. Only the lower
+ *           triangle of G is summed, since the solver reads nothing else.
+ *        4. The bias is finally set so that the model passes through the means.
+ ********************************************************************************/
+bool ArxModel::Fit(const double* input, const double* output, const size_t num_samples,
+                   const double lambda) {
+    const auto num_features{2 * order_};
+    if (order_ == 0 || num_samples <= order_ + num_features) return false;
+    const auto num_sets{num_samples - order_};
+
+    container::Matrix<double> gram{num_features, num_features};
+    container::Vector<double> scratch{3 * num_features};
+    if (gram.Rows() != num_features || scratch.Size() != 3 * num_features) return false;
+    for (auto& value : scratch) {
+        value = 0.0;
+    }
+    auto covariances{scratch.Data()};
+    auto means{covariances + num_features};
+    auto features{means + num_features};
+    double output_mean{};
+
+    for (auto t{order_}; t < num_samples; ++t) {
+        for (size_t j{}; j < order_; ++j) {
+            means[j] += input[t - j];
+            means[order_ + j] += output[t - 1 - j];
+        }
+        output_mean += output[t];
+    }
+    for (size_t j{}; j < num_features; ++j) {
+        means[j] /= num_sets;
+    }
+    output_mean /= num_sets;
+
+    for (auto t{order_}; t < num_samples; ++t) {
+        for (size_t j{}; j < order_; ++j) {
+            features[j] = input[t - j] - means[j];
+            features[order_ + j] = output[t - 1 - j] - means[order_ + j];
+        }
+        const auto centered_output{output[t] - output_mean};
+        for (size_t j{}; j < num_features; ++j) {
+            covariances[j] += features[j] * centered_output;
+            for (size_t l{}; l <= j; ++l) {
+                gram(j, l) += features[j] * features[l];
+            }
+        }
+    }
+    for (size_t j{}; j < num_features; ++j) {
+        covariances[j] /= num_sets;
+        for (size_t l{}; l <= j; ++l) {
+            gram(j, l) /= num_sets;
+        }
+        gram(j, j) += lambda;
+    }
+
+    if (!container::CholeskySolve(gram, covariances)) return false;
+    bias_ = output_mean;
+    for (size_t j{}; j < num_features; ++j) {
+        weights_[j] = covariances[j];
+        bias_ -= means[j] * weights_[j];
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The windows of sample t start at x[t] and y[t - 1] and run backwards
+ *           through the trace, i.e. with stride -1.
+ ********************************************************************************/
+double ArxModel::MeanSquaredError(const double* input, const double* output,
+                                  const size_t num_samples) const {
+    if (num_samples <= order_) return 0.0;
+    double sum{};
+    for (auto t{order_}; t < num_samples; ++t) {
+        const auto error{output[t] - Predict(input + t, -1, output + t - 1, -1)};
+        sum += error * error;
+    }
+    return sum / (num_samples - order_);
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each input and output is multiplied by its weight, where the
+ *           windows are stepped through with their strides. The pointers are
+ *           never stepped past the last value, since the trace windows run
+ *           backwards to the start of the trace.
+ ********************************************************************************/
+double ArxModel::Predict(const double* inputs, const int8_t input_stride, const double* outputs,
+                         const int8_t output_stride) const {
+    auto prediction{bias_};
+    for (size_t j{}; j < order_; ++j) {
+        prediction += weights_[j] * *inputs + weights_[order_ + j] * *outputs;
+        if (j + 1 < order_) {
+            inputs += input_stride;
+            outputs += output_stride;
+        }
+    }
+    return prediction;
+}
+
+} /* namespace yrgo */
\ No newline at end of file
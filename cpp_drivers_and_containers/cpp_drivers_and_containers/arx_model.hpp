@@ -0,0 +1,189 @@
+/********************************************************************************
+ * @brief Library for implementing autoregressive models with exogenous input
+ *        (ARX models) in C++, i.e. models predicting from the latest inputs
+ *        and outputs instead of the current input only.
+ ********************************************************************************/
+#pragma once
+
+#include <vector.hpp>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing ARX models of specified order k, where the
+ *        prediction is calculated as
+ *
+ *          y_pred[t] = a0 * x[t] + a1 * x[t - 1] + ... + a(k-1) * x[t - k + 1]
+ *                    + b1 * y[t - 1] + b2 * y[t - 2] + ... + bk * y[t - k] + m,
+ *
+ *        where x is the input (e.g. a lagging sensor voltage) and y the output.
+ *        This compensates for sensor lag, which biases a model predicting from
+ *        the current input alone during transients.
+ *
+ *        The latest inputs and outputs are held in fixed-size ring buffers,
+ *        which are allocated once by the constructor. Each update then costs
+ *        O(k) without any allocations. Logged traces are trained on via sliding
+ *        windows directly over the trace arrays, i.e. the data is never copied.
+ ********************************************************************************/
+class ArxModel {
+  public:
+
+    /********************************************************************************
+     * @brief Creates new ARX model of specified order with all weights and the
+     *        history set to zero.
+     *
+     * @param order
+     *        The number of inputs and outputs the prediction is based on
+     *        (default = 2).
+     ********************************************************************************/
+    explicit ArxModel(const size_t order = 2);
+
+    /********************************************************************************
+     * @brief Provides the order of the model.
+     ********************************************************************************/
+    size_t Order(void) const { return order_; }
+
+    /********************************************************************************
+     * @brief Provides the weights of the model, i.e. the input weights a0 - a(k-1)
+     *        followed by the output weights b1 - bk.
+     ********************************************************************************/
+    const container::Vector<double>& Weights(void) const { return weights_; }
+
+    /********************************************************************************
+     * @brief Provides the bias (m-value) of the model.
+     ********************************************************************************/
+    double Bias(void) const { return bias_; }
+
+    /********************************************************************************
+     * @brief Fills the history with specified input and output, i.e. as if the
+     *        system had been at rest at this operating point. Should be called
+     *        before the first update, e.g. with the first reading and the output
+     *        predicted for it.
+     *
+     * @param input
+     *        The input value to fill the input history with (default = 0).
+     * @param output
+     *        The output value to fill the output history with (default = 0).
+     ********************************************************************************/
+    void Reset(const double input = 0.0, const double output = 0.0);
+
+    /********************************************************************************
+     * @brief Adds specified input to the history and makes a prediction, which is
+     *        then added to the output history. Used when the output isn't
+     *        measured, i.e. the model runs on its own predictions.
+     *
+     * @param input
+     *        The new input value (x).
+     * @return
+     *        The predicted output.
+     ********************************************************************************/
+    double Update(const double input);
+
+    /********************************************************************************
+     * @brief Adds specified input to the history and makes a prediction, after
+     *        which the specified measured output is added to the output history.
+     *        Used when the output is measured, e.g. by a reference sensor.
+     *
+     * @param input
+     *        The new input value (x).
+     * @param output
+     *        The measured output value (y_ref) for the input.
+     * @return
+     *        The predicted output (made before the measured output was added).
+     ********************************************************************************/
+    double Update(const double input, const double output);
+
+    /********************************************************************************
+     * @brief Fits the model to specified logged trace with closed-form (ridge)
+     *        least squares. Each sample from index k on is one training set,
+     *        whose features are read from a window sliding over the trace.
+     *
+     * @param input
+     *        Pointer to array containing the logged inputs (x), oldest first.
+     * @param output
+     *        Pointer to array containing the logged outputs (y_ref), oldest first.
+     * @param num_samples
+     *        The number of logged samples.
+     * @param lambda
+     *        The ridge penalty, which keeps the fit stable when the features are
+     *        (almost) linearly dependent (default = 0).
+     * @return
+     *        True if the model was fitted, false if the trace holds too few
+     *        samples, the memory couldn't be allocated or the features are
+     *        linearly dependent (the model is then left unchanged).
+     ********************************************************************************/
+    bool Fit(const double* input, const double* output, const size_t num_samples,
+             const double lambda = 0.0);
+
+    /********************************************************************************
+     * @brief Calculates the mean squared one-step-ahead prediction error of the
+     *        model on specified logged trace, i.e. each prediction is based on
+     *        the logged outputs.
+     *
+     * @param input
+     *        Pointer to array containing the logged inputs (x), oldest first.
+     * @param output
+     *        Pointer to array containing the logged outputs (y_ref), oldest first.
+     * @param num_samples
+     *        The number of logged samples.
+     * @return
+     *        The mean squared error (0 if the trace holds too few samples).
+     ********************************************************************************/
+    double MeanSquaredError(const double* input, const double* output,
+                            const size_t num_samples) const;
+
+  /********************************************************************************
+   * @note The private segment is only visible internally (i.e. in this class).
+   ********************************************************************************/
+  private:
+
+    /********************************************************************************
+     * @brief Struct implementing a ring buffer of the latest k values, where each
+     *        value is stored twice (k positions apart). The latest k values are
+     *        then always contiguous, newest first, starting at the head.
+     ********************************************************************************/
+    struct History {
+        container::Vector<double> values; /* Stored values, 2k in total. */
+        size_t head;                      /* Index of the newest value. */
+
+        /********************************************************************************
+         * @brief Adds specified value, which replaces the oldest value.
+         ********************************************************************************/
+        void Push(const double value, const size_t order) {
+            head = head == 0 ? order - 1 : head - 1;
+            values[head] = values[head + order] = value;
+        }
+
+        /********************************************************************************
+         * @brief Provides pointer to the latest k values, newest first.
+         ********************************************************************************/
+        const double* Window(void) const { return values.Data() + head; }
+    };
+
+    History inputs_{};                    /* Latest inputs x[t] - x[t - k + 1]. */
+    History outputs_{};                   /* Latest outputs y[t - 1] - y[t - k]. */
+    container::Vector<double> weights_{}; /* Input weights followed by output weights. */
+    double bias_{};                       /* m-value. */
+    size_t order_{};                      /* Number of inputs and outputs per prediction. */
+
+    /********************************************************************************
+     * @brief Makes a prediction with specified windows of inputs and outputs.
+     *
+     * @param inputs
+     *        Pointer to the latest k inputs, newest first.
+     * @param input_stride
+     *        The distance between two inputs (1 = newest first, -1 = oldest first).
+     * @param outputs
+     *        Pointer to the latest k outputs, newest first.
+     * @param output_stride
+     *        The distance between two outputs.
+     * @return
+     *        The predicted output.
+     ********************************************************************************/
+    double Predict(const double* inputs, const int8_t input_stride, const double* outputs,
+                   const int8_t output_stride) const;
+};
+
+} /* namespace yrgo */
\ No newline at end of file
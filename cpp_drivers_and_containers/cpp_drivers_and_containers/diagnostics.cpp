@@ -0,0 +1,131 @@
+#include <diagnostics.hpp>
+#include <serial.hpp>
+#include <watchdog.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace diagnostics {
+
+namespace {
+
+static constexpr uint16_t kBreadcrumbMagic{0xB4C5};
+
+/********************************************************************************
+ * @note Variables preserved during reset. The reset flags are written before
+ *       the .bss section is cleared, hence they must be placed in .noinit too.
+ ********************************************************************************/
+uint8_t reset_flags __attribute__((section(".noinit")));
+Breadcrumb breadcrumbs[kNumBreadcrumbs] __attribute__((section(".noinit")));
+uint8_t breadcrumb_index __attribute__((section(".noinit")));
+uint16_t breadcrumb_magic __attribute__((section(".noinit")));
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The function is placed in section .init3, which runs directly after
+ *           the stack pointer and zero register are set up, i.e. before any
+ *           other code can clear the reset flags.
+ *        2. MCUSR is copied and cleared. WDRF must be cleared before the
+ *           watchdog timer can be disabled, which is required after a watchdog
+ *           reset since the watchdog timer stays enabled with 16 ms timeout.
+ *        3. The function is naked and falls through to the next init section.
+ ********************************************************************************/
+__attribute__((naked, used, section(".init3"))) void CaptureResetFlags(void) {
+    reset_flags = MCUSR;
+	MCUSR = 0;
+	WDTCSR = (1 << WDCE) | (1 << WDE);
+	WDTCSR = 0;
+}
+
+struct Trail {
+    Breadcrumb breadcrumbs[kNumBreadcrumbs];
+	uint8_t count;
+	uint8_t index;
+};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The breadcrumbs are only valid if the magic number is intact and
+ *           the reset didn't cut the power, since RAM is random after power-on
+ *           or brown-out.
+ *        2. Valid breadcrumbs are copied, so they remain readable while new
+ *           breadcrumbs are recorded. The ring is then reset.
+ ********************************************************************************/
+Trail LatchBreadcrumbs(void) {
+    Trail trail{};
+	if (breadcrumb_magic == kBreadcrumbMagic &&
+	    !utils::Read(reset_flags, PORF, BORF)) {
+		for (uint8_t i{}; i < kNumBreadcrumbs; ++i) {
+		    trail.breadcrumbs[i] = breadcrumbs[i];
+		}
+		trail.count = kNumBreadcrumbs;
+		trail.index = breadcrumb_index % kNumBreadcrumbs;
+	}
+	for (auto& i : breadcrumbs) {
+	    i = {0xFF, 0xFF};
+	}
+	breadcrumb_index = 0;
+	breadcrumb_magic = kBreadcrumbMagic;
+	return trail;
+}
+
+const Trail last_trail{LatchBreadcrumbs()};
+
+const char* ResetCauseString(const enum ResetCause reset_cause) {
+    switch (reset_cause) {
+	    case ResetCause::kPowerOn: return "power-on";
+		case ResetCause::kExternal: return "external";
+		case ResetCause::kBrownOut: return "brown-out";
+		case ResetCause::kWatchdog: return "watchdog";
+		default: return "unknown";
+	}
+}
+
+} /* namespace */
+
+enum ResetCause GetResetCause(void) {
+    if (utils::Read(reset_flags, PORF)) return ResetCause::kPowerOn;
+	if (utils::Read(reset_flags, BORF)) return ResetCause::kBrownOut;
+	if (utils::Read(reset_flags, WDRF)) return ResetCause::kWatchdog;
+	if (utils::Read(reset_flags, EXTRF)) return ResetCause::kExternal;
+	return ResetCause::kUnknown;
+}
+
+uint8_t GetResetFlags(void) {
+    return reset_flags;
+}
+
+void Checkpoint(const uint8_t task_id, const uint8_t checkpoint) {
+    const auto sreg{utils::GlobalInterruptSave()};
+	breadcrumbs[breadcrumb_index] = {task_id, checkpoint};
+	breadcrumb_index = (breadcrumb_index + 1) % kNumBreadcrumbs;
+	utils::GlobalInterruptRestore(sreg);
+}
+
+bool ReadBreadcrumb(const uint8_t age, Breadcrumb& breadcrumb) {
+    if (age >= last_trail.count) return false;
+	const auto index{(last_trail.index + kNumBreadcrumbs - 1 - age) % kNumBreadcrumbs};
+	breadcrumb = last_trail.breadcrumbs[index];
+	return breadcrumb.task_id != 0xFF;
+}
+
+void Print(void) {
+    serial::Printf("Reset cause: %s (MCUSR = 0x%x)\n",
+	               ResetCauseString(GetResetCause()), GetResetFlags());
+	if (GetResetCause() == ResetCause::kWatchdog) {
+	    if (watchdog::LastStarvedTask() != watchdog::kNoTask) {
+	        serial::Printf("Starved task: %d\n", watchdog::LastStarvedTask());
+	    }
+	    if (watchdog::LastCrashAddress()) {
+	        serial::Printf("Crash address: 0x%x\n", watchdog::LastCrashAddress());
+	    }
+	}
+	Breadcrumb breadcrumb{};
+	for (uint8_t i{}; ReadBreadcrumb(i, breadcrumb); ++i) {
+	    serial::Printf("Breadcrumb %d: task %d, checkpoint %d\n",
+		               i, breadcrumb.task_id, breadcrumb.checkpoint);
+	}
+}
+
+} /* namespace diagnostics */
+} /* namespace driver */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,100 @@
+/********************************************************************************
+ * @brief Contains functions for post-mortem diagnostics of the ATmega328P,
+ *        i.e. the cause of the last reset and breadcrumbs recorded before it.
+ *        All information is captured at startup or preserved in the .noinit
+ *        section of the RAM, so no runtime overhead is added besides the
+ *        breadcrumbs themselves.
+ ********************************************************************************/
+#pragma once
+
+#include <utils.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace diagnostics {
+
+/********************************************************************************
+ * @brief The number of breadcrumbs held in the breadcrumb ring.
+ ********************************************************************************/
+static constexpr uint8_t kNumBreadcrumbs{8};
+
+/********************************************************************************
+ * @brief Enum class for the cause of the last reset.
+ *
+ * @param kUnknown
+ *        No reset flag was set (e.g. jump to the reset vector).
+ * @param kPowerOn
+ *        Power-on reset.
+ * @param kExternal
+ *        External reset via the RESET pin.
+ * @param kBrownOut
+ *        Brown-out reset, i.e. the supply voltage dropped too low.
+ * @param kWatchdog
+ *        Watchdog system reset.
+ ********************************************************************************/
+enum class ResetCause { kUnknown, kPowerOn, kExternal, kBrownOut, kWatchdog };
+
+/********************************************************************************
+ * @brief Struct for breadcrumbs, i.e. the last checkpoint passed by a task.
+ *
+ * @param task_id
+ *        The ID of the task recording the breadcrumb.
+ * @param checkpoint
+ *        Task specific number of the checkpoint passed.
+ ********************************************************************************/
+struct Breadcrumb {
+    uint8_t task_id;
+	uint8_t checkpoint;
+};
+
+/********************************************************************************
+ * @brief Provides the cause of the last reset. The reset flags are captured
+ *        from MCUSR during startup, before any other code has cleared them.
+ *
+ * @return
+ *        The cause of the last reset as an enumerator of enum class ResetCause.
+ ********************************************************************************/
+enum ResetCause GetResetCause(void);
+
+/********************************************************************************
+ * @brief Provides the raw content of MCUSR captured during startup.
+ *
+ * @return
+ *        The reset flags (PORF, EXTRF, BORF and WDRF).
+ ********************************************************************************/
+uint8_t GetResetFlags(void);
+
+/********************************************************************************
+ * @brief Records a breadcrumb in the breadcrumb ring, which is preserved in RAM
+ *        during a watchdog or external reset. Only the last kNumBreadcrumbs
+ *        breadcrumbs are kept. This function can be called from ISRs.
+ *
+ * @param task_id
+ *        The ID of the task passing the checkpoint.
+ * @param checkpoint
+ *        Task specific number of the checkpoint passed.
+ ********************************************************************************/
+void Checkpoint(const uint8_t task_id, const uint8_t checkpoint);
+
+/********************************************************************************
+ * @brief Reads a breadcrumb recorded before the last reset.
+ *
+ * @param age
+ *        The age of the breadcrumb, where 0 is the last breadcrumb recorded.
+ * @param breadcrumb
+ *        Reference to variable for storing the breadcrumb.
+ * @return
+ *        True if a breadcrumb was read, false if no such breadcrumb exists.
+ ********************************************************************************/
+bool ReadBreadcrumb(const uint8_t age, Breadcrumb& breadcrumb);
+
+/********************************************************************************
+ * @brief Prints the reset cause, the starved task and program address captured
+ *        by the watchdog timer (if any) and the breadcrumbs recorded before the
+ *        last reset in the serial terminal.
+ ********************************************************************************/
+void Print(void);
+
+} /* namespace diagnostics */
+} /* namespace driver */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,69 @@
+/********************************************************************************
+ * @brief Implementation details for the DriftMonitor class.
+ ********************************************************************************/
+#include <drift_monitor.hpp>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The residual is calculated before the reading is added to the 
+ *           training data, i.e. with the model trained without it.
+ *        2. During retraining, the reading is only added to the training data.
+ *        3. Else the squared residual is normalized by the baseline and clipped
+ *           to half the threshold, so a single outlier can't confirm drift.
+ *        4. The CUSUM statistic accumulates the amount by which x exceeds its
+ *           expected value 1 plus the allowance, but never drops below zero.
+ *        5. When the statistic exceeds the threshold, drift is confirmed and
+ *           the epoch budget of the retraining is set.
+ ********************************************************************************/
+bool DriftMonitor::AddReference(const double input, const double reference) {
+    const auto residual{reference - model_.Predict(input)};
+    model_.AddTrainingSample(input, reference);
+    if (Drifted()) return true;
+
+    const auto limit{threshold_ / 2};
+    auto x{residual * residual / baseline_};
+    if (!(x < limit)) x = limit;
+    statistic_ += x - 1.0 - allowance_;
+    if (statistic_ < 0) statistic_ = 0;
+
+    if (statistic_ > threshold_) {
+        remaining_epochs_ = max_epochs_;
+        num_drifts_++;
+    }
+    return Drifted();
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Nothing is done unless a retraining is pending and at least one
+ *           epoch is requested, so a step always makes progress.
+ *        2. The model is trained with the specified number of epochs, but not
+ *           more than what's left of the epoch budget.
+ *        3. When the budget is spent, the baseline is recalculated, which also
+ *           restarts the drift test.
+ ********************************************************************************/
+bool DriftMonitor::RetrainStep(const uint16_t num_epochs) {
+    if (!Drifted() || num_epochs == 0) return false;
+    const auto epochs{num_epochs < remaining_epochs_ ? num_epochs : remaining_epochs_};
+    model_.Train(epochs, learning_rate_);
+    remaining_epochs_ -= epochs;
+    if (!Drifted()) Calibrate();
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The baseline is set to the mean squared error of the model on its
+ *           training data, but never below the noise floor.
+ *        2. The statistic and any pending retraining are cleared.
+ ********************************************************************************/
+void DriftMonitor::Calibrate(void) {
+    const auto mse{model_.Evaluate().mse};
+    baseline_ = mse > noise_floor_ ? mse : noise_floor_;
+    statistic_ = 0;
+    remaining_epochs_ = 0;
+}
+
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,140 @@
+/********************************************************************************
+ * @brief Library for detecting concept drift of linear regression models.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+#include <stdint.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for detecting when a model no longer fits new reference
+ *        readings, e.g. because the transfer curve of a sensor drifts with age,
+ *        and for retraining the model only when that happens.
+ *
+ *        Each new reading is added to the training data of the model and its
+ *        squared residual is compared against the training error (baseline)
+ *        with a one-sided CUSUM test:
+ *
+ *                      x = min(r^2 / baseline, threshold / 2),
+ *                      S = max(0, S + x - 1 - allowance),
+ *
+ *        where drift is confirmed when S exceeds the threshold. While the model
+ *        fits, x averages about 1 and S stays near zero. A lasting increase of
+ *        the error makes S grow steadily, while a single outlier can at most
+ *        add half the threshold.
+ *
+ *        Once drift is confirmed, the model is retrained in bounded steps via
+ *        RetrainStep, e.g. from the main loop, until the epoch budget is spent.
+ *        The baseline is then recalculated and the test restarted. Predictions
+ *        can be made from interrupts during retraining, since the parameters
+ *        are published atomically. AddReference and RetrainStep must be called
+ *        from the same context, since both access the training data.
+ *
+ *        For the new readings to replace old data, the training capacity of
+ *        the model should be limited, preferably with decayed sampling.
+ ********************************************************************************/
+class DriftMonitor {
+  public:
+
+    /********************************************************************************
+     * @brief Creates drift monitor for referenced model. The baseline is 
+     *        calculated from the current training error of the model.
+     *
+     * @param model
+     *        Reference to the monitored model.
+     * @param max_epochs
+     *        The epoch budget of each retraining (default = 100). A budget of 0
+     *        is raised to 1, since confirmed drift must lead to retraining.
+     * @param learning_rate
+     *        The learning rate of the retraining (default = 0.01).
+     * @param allowance
+     *        The relative increase of the mean squared error tolerated without
+     *        counting towards drift (default = 1.0, i.e. 100 %).
+     * @param threshold
+     *        The CUSUM threshold, higher values give fewer false alarms but 
+     *        slower detection (default = 16.0). With the default allowance, a 
+     *        model that still fits gives a false alarm about every 50 000 
+     *        readings, while a doubled error is detected within about 100.
+     * @param noise_floor
+     *        The lowest baseline used, in squared units of y_ref, for models with
+     *        (nearly) zero training error (default = 0.01).
+     ********************************************************************************/
+    explicit DriftMonitor(LinReg& model, const uint16_t max_epochs = 100, 
+                          const double learning_rate = 0.01, const double allowance = 1.0,
+                          const double threshold = 16.0, const double noise_floor = 0.01)
+        : model_{model}, max_epochs_{max_epochs > 0 ? max_epochs : static_cast<uint16_t>(1)},
+          learning_rate_{learning_rate}, allowance_{allowance}, threshold_{threshold}, 
+          noise_floor_{noise_floor} {
+        Calibrate();
+    }
+
+    /********************************************************************************
+     * @brief Adds a new reference reading. The reading is added to the training
+     *        data of the model and the drift test is updated with its residual.
+     *        No test is done while the model is retrained.
+     *
+     * @param input
+     *        The input value (x) of the reading.
+     * @param reference
+     *        The reference value (y_ref) of the reading.
+     * @return
+     *        True if drift is confirmed, i.e. the model should be retrained.
+     ********************************************************************************/
+    bool AddReference(const double input, const double reference);
+
+    /********************************************************************************
+     * @brief Retrains the model with at most specified number of epochs if drift
+     *        has been confirmed. When the epoch budget is spent, the baseline is
+     *        recalculated and the drift test restarted.
+     *
+     * @param num_epochs
+     *        The maximum number of epochs to train in this step (default = 1).
+     * @return
+     *        True if the model was trained, false if no retraining is pending or
+     *        the number of epochs is 0.
+     ********************************************************************************/
+    bool RetrainStep(const uint16_t num_epochs = 1);
+
+    /********************************************************************************
+     * @brief Recalculates the baseline from the current training error of the
+     *        model and restarts the drift test.
+     ********************************************************************************/
+    void Calibrate(void);
+
+    /********************************************************************************
+     * @brief Indicates if drift has been confirmed and the model not yet fully
+     *        retrained.
+     ********************************************************************************/
+    bool Drifted(void) const { return remaining_epochs_ > 0; }
+
+    /********************************************************************************
+     * @brief Provides the current CUSUM statistic.
+     ********************************************************************************/
+    double Statistic(void) const { return statistic_; }
+
+    /********************************************************************************
+     * @brief Provides the baseline, i.e. the mean squared training error.
+     ********************************************************************************/
+    double Baseline(void) const { return baseline_; }
+
+    /********************************************************************************
+     * @brief Provides the number of times drift has been confirmed.
+     ********************************************************************************/
+    uint16_t NumDrifts(void) const { return num_drifts_; }
+
+  private:
+    LinReg& model_;               /* The monitored model. */
+    uint16_t max_epochs_;         /* Epoch budget of each retraining. */
+    double learning_rate_;        /* Learning rate of the retraining. */
+    double allowance_;            /* Tolerated relative error increase. */
+    double threshold_;            /* CUSUM threshold. */
+    double noise_floor_;          /* Lowest baseline. */
+    double baseline_{};           /* Mean squared training error. */
+    double statistic_{};          /* CUSUM statistic. */
+    uint16_t remaining_epochs_{}; /* Epochs left of the retraining. */
+    uint16_t num_drifts_{};       /* Number of confirmed drifts. */
+};
+
+} /* namespace yrgo */
\ No newline at end of file
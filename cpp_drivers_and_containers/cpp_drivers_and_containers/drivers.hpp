@@ -1,13 +1,15 @@
-/********************************************************************************
- * @brief Contains miscellaneous cpp_drivers_and_containers for microcontroller ATmega328P.
- ********************************************************************************/
-#pragma once
-
-#include <adc.hpp>
-#include <eeprom.hpp>
-#include <gpio.hpp>
-#include <serial.hpp>
-#include <timer.hpp>
-#include <type_traits.hpp>
-#include <utils.hpp>
+/********************************************************************************
+ * @brief Contains miscellaneous cpp_drivers_and_containers for microcontroller ATmega328P.
+ ********************************************************************************/
+#pragma once
+
+#include <adc.hpp>
+#include <diagnostics.hpp>
+#include <eeprom.hpp>
+#include <eeprom_log.hpp>
+#include <gpio.hpp>
+#include <serial.hpp>
+#include <timer.hpp>
+#include <type_traits.hpp>
+#include <utils.hpp>
 #include <watchdog.hpp>
\ No newline at end of file
@@ -1,126 +1,323 @@
-/********************************************************************************
- * @brief Contains functions for writing and reading to the EEPROM memory of
- *        the ATMega328P microcontroller. Data is stored as separate bytes.
- ********************************************************************************/
-#pragma once
-
-#include <utils.hpp>
-#include <type_traits.hpp>
-
-namespace yrgo {
-namespace driver {
-namespace eeprom {
-
-/********************************************************************************
- * @brief Parameters for the EEPROM memory.
- *
- * @param kAddressWidth
- *        The address width of the EEPROM memory.
- * @param kAddressMin
- *        Minimum permitted EEPROM address.
- * @param kAddressMax
- *        Maximum permitted EEPROM address.
- ********************************************************************************/
-static constexpr uint16_t kAddressWidth{1024};
-static constexpr uint16_t kAddressMin{0};
-static constexpr uint16_t kAddressMax{kAddressWidth - 1};
-
-namespace {
-namespace detail {
-
-/********************************************************************************
- * @brief Indicates if specified address is valid for EEPROM write/read, i.e.
- *        the address lies within interval [0, 1023].
- *
- * @param address
- *        The address to check.
- * @return
- *        True if the address is valid, else false.
- ********************************************************************************/
-template <typename T = uint8_t>
-bool constexpr AddressValid(const uint16_t address) {
-	return address <= kAddressWidth - sizeof(T);
-}
-
-/********************************************************************************
- * @brief Writes a single byte of data to specified address in EEPROM.
- *
- * @param address
- *        The destination address.
- * @param data
- *        The data to write to the destination address.
- ********************************************************************************/
-void WriteByte(const uint16_t address, const uint8_t data) {
-    while (utils::Read(EECR, EEPE));
-	EEAR = address;
-	EEDR = data;
-	utils::GlobalInterruptDisable();
-	utils::Set(EECR, EEMPE);
-	utils::Set(EECR, EEPE);
-    utils::GlobalInterruptEnable();
-}
-
-/********************************************************************************
- * @brief Reads a single byte of data to specified address in EEPROM.
- *
- * @param address
- *        The address to read from.
- * @return
- *        The data stored at specified address.
- ********************************************************************************/
-uint8_t ReadByte(const uint16_t address) {
-    while (utils::Read(EECR, EEPE));
-	EEAR = address;
-	utils::Set(EECR, EERE);
-	return EEDR;
-}
-} /* namespace detail */
-
-/********************************************************************************
- * @brief Writes data to specified address in EEPROM. If more than one byte is
- *        to be written, the other bytes are written to the consecutive addresses 
- *        until all bytes are stored.
- *
- * @param address
- *        The destination address.
- * @param data
- *        The data to write to the destination address.
- * @return
- *        True if the write succeeded, false if an invalid address was specified.
- ********************************************************************************/
-template <typename T = uint8_t>
-bool Write(const uint16_t address, const T& data) {
-    static_assert(type_traits::is_unsigned<T>::value, "EEPROM write only permitted for unsigned data types!");
-    if (!detail::AddressValid<T>(address)) return false;
-	for (size_t i{}; i < sizeof(T); ++i) {
-	    detail::WriteByte(address + i, static_cast<uint8_t>(data >> (8 * i)));
-	}
-	return true;
-}
-
-/********************************************************************************
- * @brief Reads data from specified address in EEPROM. If more than one byte is
- *        to be read, the consecutive addresses are read until all bytes are read.
- *
- * @param address
- *        The destination address.
- * @param data
- *        Reference to variable for storing the data read from specified address.
- * @return
- *        True if the read succeeded, false if an invalid address was specified.
- ********************************************************************************/
-template <typename T = uint8_t>
-bool Read(const uint16_t address, T& data) {
-    static_assert(type_traits::is_unsigned<T>::value, "EEPROM read only permitted for unsigned data types!");
-    if (!detail::AddressValid<T>(address)) return false;
-	data = {};
-	for (size_t i{}; i < sizeof(T); ++i) {
-	    data |= static_cast<T>(detail::ReadByte(address + i) << (8 * i));
-	}
-	return true;
-}
-
-} /* namespace */
-} /* namespace eeprom */
-} /* namespace driver */
+/********************************************************************************
+ * @brief Contains functions for writing and reading to the EEPROM memory of
+ *        the ATMega328P microcontroller. Data is stored as separate bytes.
+ ********************************************************************************/
+#pragma once
+
+#include <utils.hpp>
+#include <type_traits.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace eeprom {
+
+/********************************************************************************
+ * @brief Parameters for the EEPROM memory.
+ *
+ * @param kAddressWidth
+ *        The address width of the EEPROM memory.
+ * @param kAddressMin
+ *        Minimum permitted EEPROM address.
+ * @param kAddressMax
+ *        Maximum permitted EEPROM address.
+ ********************************************************************************/
+static constexpr uint16_t kAddressWidth{1024};
+static constexpr uint16_t kAddressMin{0};
+static constexpr uint16_t kAddressMax{kAddressWidth - 1};
+
+/********************************************************************************
+ * @brief Enum class for selecting the checksum used to validate records.
+ *
+ * @param kNone
+ *        No checksum, only the version and size of the record are validated.
+ * @param kCrc8
+ *        8-bit CRC checksum.
+ * @param kCrc16
+ *        16-bit CRC checksum.
+ ********************************************************************************/
+enum class Checksum { kNone = 0, kCrc8 = 1, kCrc16 = 2 };
+
+namespace {
+namespace detail {
+
+/********************************************************************************
+ * @brief Indicates if specified address is valid for EEPROM write/read, i.e.
+ *        the address lies within interval [0, 1023].
+ *
+ * @param address
+ *        The address to check.
+ * @return
+ *        True if the address is valid, else false.
+ ********************************************************************************/
+template <typename T = uint8_t>
+bool constexpr AddressValid(const uint16_t address) {
+	return address <= kAddressWidth - sizeof(T);
+}
+
+/********************************************************************************
+ * @brief Indicates if a block of specified size starting at specified address
+ *        fits within the EEPROM memory.
+ *
+ * @param address
+ *        The start address of the block.
+ * @param size
+ *        The size of the block in bytes.
+ * @return
+ *        True if the block is valid, else false.
+ ********************************************************************************/
+bool constexpr BlockValid(const uint16_t address, const size_t size) {
+	return size <= kAddressWidth && address <= kAddressWidth - size;
+}
+
+/********************************************************************************
+ * @brief Writes a single byte of data to specified address in EEPROM.
+ *
+ * @param address
+ *        The destination address.
+ * @param data
+ *        The data to write to the destination address.
+ ********************************************************************************/
+void WriteByte(const uint16_t address, const uint8_t data) {
+    while (utils::Read(EECR, EEPE));
+	EEAR = address;
+	EEDR = data;
+	const auto sreg{utils::GlobalInterruptSave()};
+	utils::Set(EECR, EEMPE);
+	utils::Set(EECR, EEPE);
+    utils::GlobalInterruptRestore(sreg);
+}
+
+/********************************************************************************
+ * @brief Reads a single byte of data to specified address in EEPROM.
+ *
+ * @param address
+ *        The address to read from.
+ * @return
+ *        The data stored at specified address.
+ ********************************************************************************/
+uint8_t ReadByte(const uint16_t address) {
+    while (utils::Read(EECR, EEPE));
+	EEAR = address;
+	utils::Set(EECR, EERE);
+	return EEDR;
+}
+
+/********************************************************************************
+ * @brief Writes a single byte of data to specified address in EEPROM only if
+ *        the stored byte differs. Skipping unchanged bytes saves both the
+ *        3.3 ms write time and an erase/write cycle of the EEPROM cell.
+ *
+ * @param address
+ *        The destination address.
+ * @param data
+ *        The data to write to the destination address.
+ ********************************************************************************/
+void UpdateByte(const uint16_t address, const uint8_t data) {
+    if (ReadByte(address) != data) {
+	    WriteByte(address, data);
+	}
+}
+/********************************************************************************
+ * @brief Calculates the checksum of a block stored in EEPROM.
+ *
+ * @param address
+ *        The start address of the block.
+ * @param size
+ *        The size of the block in bytes.
+ * @param checksum
+ *        The checksum to calculate.
+ * @return
+ *        The calculated checksum (0 if no checksum is used).
+ ********************************************************************************/
+uint16_t CalculateChecksum(const uint16_t address, const size_t size, const enum Checksum checksum) {
+    uint16_t crc{checksum == Checksum::kCrc16 ? static_cast<uint16_t>(0xFFFF) : static_cast<uint16_t>(0)};
+	for (size_t i{}; i < size && checksum != Checksum::kNone; ++i) {
+	    const auto byte{ReadByte(address + i)};
+		crc = checksum == Checksum::kCrc16 ? utils::Crc16(&byte, 1, crc) : 
+		                                     utils::Crc8(&byte, 1, static_cast<uint8_t>(crc));
+	}
+	return crc;
+}
+} /* namespace detail */
+
+/********************************************************************************
+ * @brief Writes a block of bytes to consecutive addresses in EEPROM, starting
+ *        at specified address. Bytes already holding the same value are not
+ *        rewritten to reduce wear of the EEPROM cells.
+ *
+ * @param address
+ *        The destination address of the first byte.
+ * @param data
+ *        Pointer to the data to write.
+ * @param size
+ *        The number of bytes to write.
+ * @return
+ *        True if the write succeeded, false if the block doesn't fit in EEPROM.
+ ********************************************************************************/
+bool WriteBlock(const uint16_t address, const void* data, const size_t size) {
+    if (!detail::BlockValid(address, size)) return false;
+	const auto bytes{static_cast<const uint8_t*>(data)};
+	for (size_t i{}; i < size; ++i) {
+	    detail::UpdateByte(address + i, bytes[i]);
+	}
+	return true;
+}
+
+/********************************************************************************
+ * @brief Reads a block of bytes from consecutive addresses in EEPROM, starting
+ *        at specified address.
+ *
+ * @param address
+ *        The address of the first byte to read.
+ * @param data
+ *        Pointer to memory for storing the bytes read.
+ * @param size
+ *        The number of bytes to read.
+ * @return
+ *        True if the read succeeded, false if the block doesn't fit in EEPROM.
+ ********************************************************************************/
+bool ReadBlock(const uint16_t address, void* data, const size_t size) {
+    if (!detail::BlockValid(address, size)) return false;
+	const auto bytes{static_cast<uint8_t*>(data)};
+	for (size_t i{}; i < size; ++i) {
+	    bytes[i] = detail::ReadByte(address + i);
+	}
+	return true;
+}
+
+/********************************************************************************
+ * @brief Writes data to specified address in EEPROM. If more than one byte is
+ *        to be written, the other bytes are written to the consecutive addresses 
+ *        until all bytes are stored. Any trivially copyable type can be written,
+ *        such as floating-point numbers, structs and static arrays.
+ *
+ * @param address
+ *        The destination address.
+ * @param data
+ *        The data to write to the destination address.
+ * @return
+ *        True if the write succeeded, false if an invalid address was specified.
+ ********************************************************************************/
+template <typename T = uint8_t>
+bool Write(const uint16_t address, const T& data) {
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+	              "EEPROM write only permitted for trivially copyable data types!");
+    return WriteBlock(address, &data, sizeof(T));
+}
+
+/********************************************************************************
+ * @brief Reads data from specified address in EEPROM. If more than one byte is
+ *        to be read, the consecutive addresses are read until all bytes are read.
+ *        Any trivially copyable type can be read, such as floating-point numbers,
+ *        structs and static arrays.
+ *
+ * @param address
+ *        The destination address.
+ * @param data
+ *        Reference to variable for storing the data read from specified address.
+ * @return
+ *        True if the read succeeded, false if an invalid address was specified.
+ ********************************************************************************/
+template <typename T = uint8_t>
+bool Read(const uint16_t address, T& data) {
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+	              "EEPROM read only permitted for trivially copyable data types!");
+    return ReadBlock(address, &data, sizeof(T));
+}
+
+/********************************************************************************
+ * @brief Provides the number of bytes occupied in EEPROM by a record of type T,
+ *        i.e. the header holding version, size and checksum plus the data.
+ *
+ * @tparam T
+ *         The data type stored in the record.
+ * @tparam checksum
+ *         The checksum used to validate the record (default = CRC-16).
+ * @return
+ *         The size of the record in bytes.
+ ********************************************************************************/
+template <typename T, enum Checksum checksum = Checksum::kCrc16>
+constexpr size_t RecordSize(void) {
+    return 3 + static_cast<size_t>(checksum) + sizeof(T);
+}
+
+/********************************************************************************
+ * @brief Writes data as a versioned record to specified address in EEPROM.
+ *        The record consists of a header holding the layout version, the size
+ *        of the data and an optional checksum, followed by the data:
+ *
+ *                   [version (1 B)][size (2 B)][checksum (0 - 2 B)][data]
+ *
+ *        The checksum is calculated from the data in RAM, not read back from
+ *        EEPROM, so a byte programmed incorrectly (e.g. a worn cell or a
+ *        brown-out during the write) makes the record fail validation.
+ *
+ *        The version should be increased each time the layout of T is changed,
+ *        so that data stored with an old layout is rejected when read.
+ *
+ * @tparam checksum
+ *         The checksum used to validate the record (default = CRC-16).
+ * @param address
+ *        The destination address of the record.
+ * @param data
+ *        The data to store, for instance a struct containing model parameters.
+ * @param version
+ *        The layout version of the data (default = 0).
+ * @return
+ *        True if the write succeeded, false if the record doesn't fit in EEPROM.
+ ********************************************************************************/
+template <enum Checksum checksum = Checksum::kCrc16, typename T>
+bool WriteRecord(const uint16_t address, const T& data, const uint8_t version = 0) {
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+	              "EEPROM records only permitted for trivially copyable data types!");
+	static_assert(sizeof(T) < kAddressWidth, "EEPROM record too large!");
+	if (!detail::BlockValid(address, RecordSize<T, checksum>())) return false;
+	const uint16_t size{sizeof(T)};
+	const uint16_t data_address{static_cast<uint16_t>(address + 3 + static_cast<uint8_t>(checksum))};
+	uint16_t crc{};
+	if (checksum == Checksum::kCrc16) crc = utils::Crc16(&data, sizeof(T));
+	if (checksum == Checksum::kCrc8) crc = utils::Crc8(&data, sizeof(T));
+	WriteBlock(data_address, &data, sizeof(T));
+	WriteBlock(address + 3, &crc, static_cast<uint8_t>(checksum));
+	WriteBlock(address + 1, &size, sizeof(size));
+	return WriteBlock(address, &version, sizeof(version));
+}
+
+/********************************************************************************
+ * @brief Reads versioned record from specified address in EEPROM. The data is
+ *        only assigned if the stored version, size and checksum are valid. The
+ *        checksum is calculated directly from EEPROM, so no temporary copy of
+ *        the data is needed.
+ *
+ * @tparam checksum
+ *         The checksum used to validate the record (default = CRC-16).
+ * @param address
+ *        The address of the record.
+ * @param data
+ *        Reference to variable for storing the data read.
+ * @param version
+ *        The expected layout version of the data (default = 0).
+ * @return
+ *        True if a valid record was read, else false.
+ ********************************************************************************/
+template <enum Checksum checksum = Checksum::kCrc16, typename T>
+bool ReadRecord(const uint16_t address, T& data, const uint8_t version = 0) {
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+	              "EEPROM records only permitted for trivially copyable data types!");
+	static_assert(sizeof(T) < kAddressWidth, "EEPROM record too large!");
+	if (!detail::BlockValid(address, RecordSize<T, checksum>())) return false;
+	uint8_t stored_version{};
+	uint16_t stored_size{}, stored_crc{};
+	ReadBlock(address, &stored_version, sizeof(stored_version));
+	ReadBlock(address + 1, &stored_size, sizeof(stored_size));
+	ReadBlock(address + 3, &stored_crc, static_cast<uint8_t>(checksum));
+	if (stored_version != version || stored_size != sizeof(T)) return false;
+	const uint16_t data_address{static_cast<uint16_t>(address + 3 + static_cast<uint8_t>(checksum))};
+	if (stored_crc != detail::CalculateChecksum(data_address, sizeof(T), checksum)) return false;
+	return ReadBlock(data_address, &data, sizeof(T));
+}
+
+} /* namespace */
+} /* namespace eeprom */
+} /* namespace driver */
 } /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,264 @@
+/********************************************************************************
+ * @brief Wear-leveled circular record log stored in the EEPROM memory of the
+ *        ATMega328P microcontroller.
+ ********************************************************************************/
+#pragma once
+
+#include <eeprom.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace eeprom {
+
+/********************************************************************************
+ * @brief Class for implementation of an append-only record log in EEPROM.
+ *
+ *        The specified EEPROM region is divided into slots, each holding one
+ *        record preceded by a header:
+ *
+ *                     [sequence (2 B)][CRC-8 (1 B)][record]
+ *
+ *        New records are always written to the slot after the newest one, so
+ *        the erase/write cycles are spread evenly over the whole region instead
+ *        of wearing out a single address. The sequence number is incremented
+ *        for each record and the CRC covers both the sequence number and the
+ *        record, so a write interrupted by a power loss is detected and ignored.
+ *        The sequence number 0xFFFF is reserved for empty (erased) slots.
+ *
+ * @tparam T
+ *         The record type, stored as raw bytes.
+ * @tparam kStartAddress
+ *         The first EEPROM address of the log region (default = 0).
+ * @tparam kEndAddress
+ *         The address after the last byte of the log region (default = 1024).
+ ********************************************************************************/
+template <typename T, uint16_t kStartAddress = kAddressMin, uint16_t kEndAddress = kAddressWidth>
+class Log {
+    static_assert(kStartAddress < kEndAddress && kEndAddress <= kAddressWidth,
+	              "Invalid EEPROM region selected for log!");
+  public:
+
+    /********************************************************************************
+	 * @brief The size of each slot in bytes (header + record).
+	 ********************************************************************************/
+    static constexpr uint16_t kSlotSize{3 + sizeof(T)};
+
+	/********************************************************************************
+	 * @brief The maximum number of records held by the log.
+	 ********************************************************************************/
+    static constexpr uint16_t kCapacity{(kEndAddress - kStartAddress) / kSlotSize};
+	static_assert(kCapacity >= 2, "EEPROM log region must hold at least two records!");
+
+	/********************************************************************************
+	 * @brief Creates log and locates the newest record stored in EEPROM.
+	 ********************************************************************************/
+    Log(void) { Init(); }
+
+	/********************************************************************************
+	 * @brief Copy constructor deleted.
+	 ********************************************************************************/
+	Log(Log&) = delete;
+
+	/********************************************************************************
+	 * @brief Assignment operator deleted.
+	 ********************************************************************************/
+	Log& operator=(Log&) = delete;
+
+	/********************************************************************************
+	 * @brief Move constructor deleted.
+	 ********************************************************************************/
+	Log(Log&&) = delete;
+
+	/********************************************************************************
+	 * @brief Provides the number of records currently stored in the log.
+	 *
+	 * @return
+	 *        The number of stored records.
+	 ********************************************************************************/
+	uint16_t Count(void) const { return count_; }
+
+	/********************************************************************************
+	 * @brief Indicates if the log is empty.
+	 *
+	 * @return
+	 *        True if the log is empty, else false.
+	 ********************************************************************************/
+	bool Empty(void) const { return count_ == 0; }
+
+	/********************************************************************************
+	 * @brief Provides the sequence number of the newest record.
+	 *
+	 * @return
+	 *        The sequence number of the newest record or 0xFFFF if the log is empty.
+	 ********************************************************************************/
+	uint16_t Sequence(void) const { return sequence_; }
+
+    /********************************************************************************
+	 * @brief Scans the log region for the newest record. Only the sequence
+	 *        numbers are read during the scan, which makes the scan fast enough
+	 *        to run at boot. The CRC of the newest record is checked, since it's
+	 *        the only record that can have been torn by a power loss. If it
+	 *        fails, the previous slot becomes the newest record with the
+	 *        sequence number it actually holds, since a torn sequence number
+	 *        can hold any value.
+	 ********************************************************************************/
+	void Init(void) {
+	    head_ = kCapacity - 1;
+		sequence_ = kEmpty;
+		count_ = 0;
+
+		const auto first{ReadSequence(0)};
+		auto current{first};
+		for (uint16_t i{}; i < kCapacity; ++i) {
+		    const auto next{i + 1 < kCapacity ? ReadSequence(i + 1) : first};
+			if (current != kEmpty && next != NextSequence(current)) {
+			    head_ = i;
+				sequence_ = current;
+				break;
+			}
+			current = next;
+		}
+
+		if (sequence_ == kEmpty) return;
+		if (!SlotValid(head_, sequence_)) {
+		    head_ = Previous(head_);
+			sequence_ = ReadSequence(head_);
+			if (sequence_ == kEmpty || !SlotValid(head_, sequence_)) {
+			    sequence_ = kEmpty;
+			    return;
+			}
+		}
+
+		auto slot{head_};
+		auto sequence{sequence_};
+		while (count_ < kCapacity && ReadSequence(slot) == sequence) {
+		    ++count_;
+			slot = Previous(slot);
+			sequence = PreviousSequence(sequence);
+		}
+	}
+
+	/********************************************************************************
+	 * @brief Appends new record to the log. The oldest record is overwritten if
+	 *        the log is full. The record is written before the sequence number,
+	 *        so the record doesn't become the newest until it's complete.
+	 *
+	 * @param record
+	 *        Reference to the record to append.
+	 * @return
+	 *        True if the record was appended, else false.
+	 ********************************************************************************/
+	bool Append(const T& record) {
+	    const auto slot{Next(head_)};
+		const auto sequence{NextSequence(sequence_)};
+		const auto address{SlotAddress(slot)};
+		const auto crc{Checksum(sequence, record)};
+
+		if (!WriteBlock(address + kRecordOffset, &record, sizeof(T)) ||
+		    !WriteBlock(address + kCrcOffset, &crc, sizeof(crc)) ||
+			!WriteBlock(address, &sequence, sizeof(sequence))) {
+			return false;
+		}
+		head_ = slot;
+		sequence_ = sequence;
+		if (count_ < kCapacity) ++count_;
+		return true;
+	}
+
+	/********************************************************************************
+	 * @brief Reads stored record. The CRC of the record is verified before
+	 *        returning.
+	 *
+	 * @param age
+	 *        The age of the record to read, where 0 is the newest record and
+	 *        Count() - 1 is the oldest.
+	 * @param record
+	 *        Reference to variable for storing the record read.
+	 * @return
+	 *        True if a valid record was read, else false.
+	 ********************************************************************************/
+	bool Read(const uint16_t age, T& record) const {
+	    if (age >= count_) return false;
+		const auto slot{static_cast<uint16_t>((head_ + kCapacity - age) % kCapacity)};
+		const auto sequence{static_cast<uint16_t>((static_cast<uint32_t>(sequence_) + kEmpty - age) % kEmpty)};
+		uint8_t crc{};
+		return ReadSequence(slot) == sequence &&
+		       ReadBlock(SlotAddress(slot) + kCrcOffset, &crc, sizeof(crc)) &&
+		       ReadBlock(SlotAddress(slot) + kRecordOffset, &record, sizeof(T)) &&
+			   crc == Checksum(sequence, record);
+	}
+
+	/********************************************************************************
+	 * @brief Reads the newest record stored in the log.
+	 *
+	 * @param record
+	 *        Reference to variable for storing the record read.
+	 * @return
+	 *        True if a valid record was read, else false.
+	 ********************************************************************************/
+	bool ReadNewest(T& record) const { return Read(0, record); }
+
+	/********************************************************************************
+	 * @brief Clears the log by marking every slot as empty. Only the sequence
+	 *        numbers are erased, the stored records are left untouched.
+	 ********************************************************************************/
+	void Clear(void) {
+	    for (uint16_t i{}; i < kCapacity; ++i) {
+		    WriteBlock(SlotAddress(i), &kEmpty, sizeof(kEmpty));
+		}
+		head_ = kCapacity - 1;
+		sequence_ = kEmpty;
+		count_ = 0;
+	}
+
+  private:
+    static constexpr uint16_t kEmpty{0xFFFF};   /* Sequence number of empty slots. */
+	static constexpr uint16_t kCrcOffset{2};    /* Offset of the CRC in each slot. */
+	static constexpr uint16_t kRecordOffset{3}; /* Offset of the record in each slot. */
+
+    uint16_t head_{kCapacity - 1}; /* Slot holding the newest record. */
+	uint16_t sequence_{kEmpty};    /* Sequence number of the newest record. */
+	uint16_t count_{};             /* Number of records stored. */
+
+	static constexpr uint16_t SlotAddress(const uint16_t slot) {
+	    return kStartAddress + slot * kSlotSize;
+	}
+
+	static constexpr uint16_t Next(const uint16_t slot) {
+	    return slot + 1 < kCapacity ? slot + 1 : 0;
+	}
+
+	static constexpr uint16_t Previous(const uint16_t slot) {
+	    return slot > 0 ? slot - 1 : kCapacity - 1;
+	}
+
+	static constexpr uint16_t NextSequence(const uint16_t sequence) {
+	    return sequence + 1 < kEmpty ? sequence + 1 : 0;
+	}
+
+	static constexpr uint16_t PreviousSequence(const uint16_t sequence) {
+	    return sequence > 0 ? sequence - 1 : kEmpty - 1;
+	}
+
+	static uint8_t Checksum(const uint16_t sequence, const T& record) {
+	    return utils::Crc8(&record, sizeof(T), utils::Crc8(&sequence, sizeof(sequence)));
+	}
+
+	static uint16_t ReadSequence(const uint16_t slot) {
+	    uint16_t sequence{kEmpty};
+		ReadBlock(SlotAddress(slot), &sequence, sizeof(sequence));
+		return sequence;
+	}
+
+	static bool SlotValid(const uint16_t slot, const uint16_t sequence) {
+	    T record{};
+		uint8_t crc{};
+		return ReadBlock(SlotAddress(slot) + kCrcOffset, &crc, sizeof(crc)) &&
+		       ReadBlock(SlotAddress(slot) + kRecordOffset, &record, sizeof(T)) &&
+		       crc == Checksum(sequence, record);
+	}
+};
+
+} /* namespace eeprom */
+} /* namespace driver */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,57 @@
+/********************************************************************************
+ * @brief Implementation details for the Histogram class.
+ ********************************************************************************/
+#include <histogram.hpp>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The bin of the code is searched for. If no bin exists, a new bin is
+ *           inserted at the position keeping the bins sorted by code.
+ *        2. The count, mean and sum of squared deviations are updated with
+ *           Welford's method:
+ *
+ *                   n = n + 1
+ *                   delta = y - mean
+ *                   mean = mean + delta / n
+ *                   sum_squares = sum_squares + delta * (y - mean)
+ ********************************************************************************/
+bool Histogram::Add(const uint16_t code, const double reference) {
+    const auto index{Find(code)};
+    if (index == bins_.Size() || bins_[index].code != code) {
+        if (bins_.Size() >= max_bins_ || !bins_.PushBack({})) return false;
+        for (auto i{bins_.Size() - 1}; i > index; --i) {
+            bins_[i] = bins_[i - 1];
+        }
+        bins_[index] = {code, 0, 0.0, 0.0};
+    }
+    auto& bin{bins_[index]};
+    const auto delta{reference - bin.mean};
+    bin.count++;
+    bin.mean += delta / bin.count;
+    bin.sum_squares += delta * (reference - bin.mean);
+    num_samples_++;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The search interval [low, high) is halved until it's empty.
+ *        2. low then holds the index of the first bin with a code that isn't
+ *           less than the searched code.
+ ********************************************************************************/
+size_t Histogram::Find(const uint16_t code) const {
+    size_t low{}, high{bins_.Size()};
+    while (low < high) {
+        const auto middle{low + (high - low) / 2};
+        if (bins_[middle].code < code) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+} /* namespace yrgo */
\ No newline at end of file
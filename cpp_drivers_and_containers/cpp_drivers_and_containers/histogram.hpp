@@ -0,0 +1,113 @@
+/********************************************************************************
+ * @brief Library for aggregating training data into per-code histogram bins.
+ ********************************************************************************/
+#pragma once
+
+#include <vector.hpp>
+#include <stdint.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for aggregating training samples keyed by an integer code, such
+ *        as the 10-bit ADC code of the input. Each distinct code gets a bin
+ *        holding the number of samples and the mean and spread of the reference
+ *        values, so the memory usage only depends on the number of distinct
+ *        codes, not on the number of samples. The mean and spread are updated
+ *        with Welford's method, which stays accurate even after millions of
+ *        samples in single-precision arithmetic.
+ ********************************************************************************/
+class Histogram {
+  public:
+
+    /********************************************************************************
+     * @brief Struct holding the sufficient statistics of each bin.
+     *
+     * @param code
+     *        The code (e.g. ADC value) of the samples in the bin.
+     * @param count
+     *        The number of samples in the bin.
+     * @param mean
+     *        The mean of the reference values in the bin.
+     * @param sum_squares
+     *        The sum of squared deviations from the mean of the reference values.
+     ********************************************************************************/
+    struct Bin {
+        uint16_t code;
+        uint32_t count;
+        double mean;
+        double sum_squares;
+    };
+
+    /********************************************************************************
+     * @brief Creates empty histogram with specified maximum number of bins.
+     *
+     * @param max_bins
+     *        The maximum number of distinct codes to store (default = 64).
+     ********************************************************************************/
+    explicit Histogram(const size_t max_bins = 64) : max_bins_{max_bins} {}
+
+    /********************************************************************************
+     * @brief Adds new sample to the bin of specified code. A new bin is created
+     *        if the code hasn't been added before.
+     *
+     * @param code
+     *        The code of the sample (e.g. ADC value).
+     * @param reference
+     *        The reference value of the sample (y_ref).
+     * @return
+     *        True if the sample was added, false if a new bin was needed but the
+     *        maximum number of bins is reached or the allocation failed.
+     ********************************************************************************/
+    bool Add(const uint16_t code, const double reference);
+
+    /********************************************************************************
+     * @brief Provides the bins of the histogram, sorted by code.
+     *
+     * @return
+     *        Reference to vector holding the bins.
+     ********************************************************************************/
+    const container::Vector<Bin>& Bins(void) const { return bins_; }
+
+    /********************************************************************************
+     * @brief Provides the number of bins, i.e. the number of distinct codes.
+     *
+     * @return
+     *        The number of bins.
+     ********************************************************************************/
+    size_t NumBins(void) const { return bins_.Size(); }
+
+    /********************************************************************************
+     * @brief Provides the total number of samples added.
+     *
+     * @return
+     *        The number of samples in all bins.
+     ********************************************************************************/
+    uint32_t NumSamples(void) const { return num_samples_; }
+
+    /********************************************************************************
+     * @brief Removes all bins and samples.
+     ********************************************************************************/
+    void Clear(void) {
+        bins_.Clear();
+        num_samples_ = 0;
+    }
+
+  private:
+    container::Vector<Bin> bins_{}; /* Bins sorted by code. */
+    size_t max_bins_{};              /* Maximum number of bins. */
+    uint32_t num_samples_{};         /* Total number of samples. */
+
+    /********************************************************************************
+     * @brief Searches for the bin of specified code via binary search.
+     *
+     * @param code
+     *        The code to search for.
+     * @return
+     *        The index of the bin holding the code or the index where a bin with
+     *        the code should be inserted.
+     ********************************************************************************/
+    size_t Find(const uint16_t code) const;
+};
+
+} /* namespace yrgo */
\ No newline at end of file
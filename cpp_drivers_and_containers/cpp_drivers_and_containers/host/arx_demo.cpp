@@ -0,0 +1,91 @@
+/********************************************************************************
+ * @brief Host program comparing a static LinReg model against ArxModel on a
+ *        simulated lagging temperature sensor, whose voltage follows the
+ *        temperature as a first-order low-pass filter. Both models are fitted
+ *        on a logged trace with reference temperatures and evaluated on a new
+ *        trace, where the ARX model runs on its own predictions (as on the
+ *        board, where no reference is available).
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/arx_demo.cpp arx_model.cpp lin_reg.cpp \
+ *                training_telemetry.cpp -o arx_demo
+ ********************************************************************************/
+#include <arx_model.hpp>
+#include <lin_reg.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSamples{5000};
+constexpr double kLag{0.2};        /* Share of the remaining step covered per sample. */
+constexpr double kGain{0.01};      /* Sensor voltage per degree. */
+constexpr double kOffset{0.5};     /* Sensor voltage at 0 degrees. */
+constexpr double kNoise{0.0005};   /* Standard deviation of the voltage noise. */
+
+/********************************************************************************
+ * @brief Simulates a trace of temperature steps and ramps and the voltage of the
+ *        lagging sensor.
+ ********************************************************************************/
+void Simulate(Vector<double>& temperature, Vector<double>& voltage, const uint32_t seed) {
+    std::mt19937 generator{seed};
+    std::uniform_real_distribution<double> level{10.0, 60.0};
+    std::uniform_int_distribution<int> duration{20, 200};
+    std::normal_distribution<double> noise{0.0, kNoise};
+    double current{level(generator)}, target{current}, step{};
+    auto sensor{kGain * current + kOffset};
+    for (size_t t{}, remaining{}; t < kNumSamples; ++t) {
+        if (remaining-- == 0) {
+            target = level(generator);
+            remaining = static_cast<size_t>(duration(generator));
+            step = generator() % 2 ? target - current : (target - current) / remaining;
+        }
+        current = std::fabs(target - current) > std::fabs(step) ? current + step : target;
+        sensor += kLag * (kGain * current + kOffset - sensor);
+        temperature[t] = current;
+        voltage[t] = sensor + noise(generator);
+    }
+}
+
+} /* namespace */
+
+int main(void) {
+    Vector<double> train_temperature{kNumSamples}, train_voltage{kNumSamples};
+    Vector<double> test_temperature{kNumSamples}, test_voltage{kNumSamples};
+    Simulate(train_temperature, train_voltage, 1);
+    Simulate(test_temperature, test_voltage, 2);
+
+    LinReg static_model{train_voltage, train_temperature};
+    static_model.Fit();
+    std::printf("Static LinReg:  test MSE %8.4f\n",
+                static_model.Evaluate(test_voltage.Data(), test_temperature.Data(), kNumSamples).mse);
+
+    for (size_t order{1}; order <= 4; ++order) {
+        ArxModel model{order};
+        if (!model.Fit(train_voltage.Data(), train_temperature.Data(), kNumSamples, 1e-9)) {
+            std::printf("ARX order %zu: fit failed\n", order);
+            continue;
+        }
+        model.Reset(test_voltage[0], static_model.Predict(test_voltage[0]));
+        double sum{};
+        const auto start{std::chrono::steady_clock::now()};
+        for (size_t t{}; t < kNumSamples; ++t) {
+            const auto error{test_temperature[t] - model.Update(test_voltage[t])};
+            sum += error * error;
+        }
+        const std::chrono::duration<double, std::nano> elapsed{std::chrono::steady_clock::now() -
+                                                               start};
+        std::printf("ARX order %zu:    test MSE %8.4f free-running, %8.4f one-step-ahead "
+                    "(%.0f ns per update)\n", order, sum / kNumSamples,
+                    model.MeanSquaredError(test_voltage.Data(), test_temperature.Data(),
+                                           kNumSamples), elapsed.count() / kNumSamples);
+    }
+    return 0;
+}
\ No newline at end of file
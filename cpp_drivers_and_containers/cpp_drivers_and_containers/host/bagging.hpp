@@ -0,0 +1,143 @@
+/********************************************************************************
+ * @brief Host-side bootstrap aggregation (bagging) of LinReg models. Each
+ *        member is trained on a bootstrap sample of the training sets, i.e.
+ *        as many sets drawn with replacement, on a thread pool.
+ *
+ *        The bootstrap samples are index views into one shared dataset, i.e.
+ *        the data is never copied, each member only holds its training order.
+ *
+ *        Since the model is linear, the mean prediction of the members equals
+ *        the prediction of one model with the mean weight and mean bias, so the
+ *        ensemble is collapsed into a single LinReg and costs nothing extra at
+ *        inference.
+ *
+ *        Host only (requires threads), not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+#include <host/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Struct holding the result of a bagged training.
+ *
+ * @param parameters
+ *        The mean weight and bias of the members, i.e. the collapsed ensemble.
+ * @param weight_stddev
+ *        The standard deviation of the member weights.
+ * @param bias_stddev
+ *        The standard deviation of the member biases.
+ * @param members
+ *        The parameters of each member.
+ * @param wall_ms
+ *        The wall-clock time of the whole training.
+ * @param job_ms
+ *        The summed training time of all members, i.e. the time needed on a
+ *        single thread.
+ * @param num_threads
+ *        The number of worker threads used.
+ ********************************************************************************/
+struct BaggingResult {
+    LinReg::Parameters parameters;
+    double weight_stddev;
+    double bias_stddev;
+    std::vector<LinReg::Parameters> members;
+    double wall_ms;
+    double job_ms;
+    size_t num_threads;
+};
+
+/********************************************************************************
+ * @brief Trains a bagged ensemble on specified training data and stores the
+ *        collapsed ensemble in specified model.
+ *
+ * @param model
+ *        Reference to the model to store the mean parameters in. Each member
+ *        starts from the current parameters of the model.
+ * @param train_in
+ *        Reference to vector containing input data (x).
+ * @param train_out
+ *        Reference to vector containing reference data (y_ref).
+ * @param num_members
+ *        The number of members in the ensemble.
+ * @param num_epochs
+ *        The number of epochs each member is trained.
+ * @param learning_rate
+ *        The learning rate of each member.
+ * @param num_threads
+ *        The number of worker threads (default = 0, one per hardware thread).
+ * @param seed
+ *        Seed for the bootstrap samples and the training order of each member,
+ *        so the result is reproducible (default = 0).
+ * @return
+ *        The collapsed parameters, the spread and parameters of the members and
+ *        timings. The model is left unchanged if no members or sets are specified.
+ ********************************************************************************/
+inline BaggingResult TrainBagged(LinReg& model, const container::Vector<double>& train_in,
+                                 const container::Vector<double>& train_out,
+                                 const size_t num_members, const size_t num_epochs,
+                                 const double learning_rate, const size_t num_threads = 0,
+                                 const uint32_t seed = 0) {
+    using Clock = std::chrono::steady_clock;
+    const auto start{Clock::now()};
+    const auto start_parameters{model.GetParameters()};
+    BaggingResult result{start_parameters, 0.0, 0.0, {}, 0.0, 0.0, 0};
+    const auto num_sets{std::min(train_in.Size(), train_out.Size())};
+    if (num_members == 0 || num_sets == 0) return result;
+
+    result.members.resize(num_members);
+    std::vector<double> job_ms(num_members);
+    {
+        ThreadPool pool{num_threads};
+        result.num_threads = pool.NumThreads();
+        for (size_t m{}; m < num_members; ++m) {
+            pool.Submit([&, m] {
+                const auto job_start{Clock::now()};
+                std::mt19937 generator{seed + static_cast<uint32_t>(m)};
+                std::uniform_int_distribution<size_t> index{0, num_sets - 1};
+                std::vector<size_t> order(num_sets);
+                for (auto& i : order) {
+                    i = index(generator);
+                }
+
+                LinReg member{};
+                member.SetParameters(start_parameters);
+                member.SetRandomSeed(seed + static_cast<uint32_t>(m) + 1);
+                member.Train(train_in.Data(), train_out.Data(), order.data(), order.size(),
+                             num_epochs, learning_rate);
+                result.members[m] = member.GetParameters();
+                job_ms[m] = std::chrono::duration<double, std::milli>(Clock::now() - job_start)
+                    .count();
+            });
+        }
+    }
+
+    LinReg::Parameters mean{0.0, 0.0};
+    for (size_t m{}; m < num_members; ++m) {
+        mean.weight += result.members[m].weight / num_members;
+        mean.bias += result.members[m].bias / num_members;
+        result.job_ms += job_ms[m];
+    }
+    for (const auto& member : result.members) {
+        result.weight_stddev += (member.weight - mean.weight) * (member.weight - mean.weight);
+        result.bias_stddev += (member.bias - mean.bias) * (member.bias - mean.bias);
+    }
+    result.weight_stddev = std::sqrt(result.weight_stddev / num_members);
+    result.bias_stddev = std::sqrt(result.bias_stddev / num_members);
+    result.parameters = mean;
+    model.SetParameters(mean);
+    result.wall_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return result;
+}
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,396 @@
+/********************************************************************************
+ * @brief Host-side checkpointing of long-running LinReg training. The training
+ *        state (parameters, epoch counter, random generator state, learning
+ *        rate and training order) is written periodically to a compact binary
+ *        file by a background thread, so the training doesn't wait for the
+ *        disk. An interrupted training resumed from the file continues
+ *        bit-exactly, i.e. it ends with the same parameters as a training that
+ *        was never interrupted. A hash of the training data is stored too, so
+ *        a checkpoint is never resumed with other training data.
+ *
+ *        File layout (little-endian, as written by the host):
+ *
+ *            uint32_t magic          "LRC2"
+ *            uint32_t num_sets       number of training sets
+ *            uint32_t data_hash      FNV-1a of the training data
+ *            uint32_t epoch          number of trained epochs
+ *            uint32_t random_state   state of the random generator
+ *            double   weight         k-value
+ *            double   bias           m-value
+ *            double   learning_rate  learning rate of the training
+ *            uint32_t order[num_sets] training order
+ *            uint32_t checksum       FNV-1a of all preceding bytes
+ *
+ *        The file is written to a temporary file which is then renamed, so a
+ *        crash during the write leaves the previous checkpoint intact.
+ *
+ *        Host only (requires threads and files), not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Struct holding a training checkpoint.
+ *
+ * @param state
+ *        The training state of the model.
+ * @param learning_rate
+ *        The learning rate of the training.
+ * @param train_order
+ *        The training order of the model.
+ * @param data_hash
+ *        The hash of the training data of the model, see HashTrainingData.
+ ********************************************************************************/
+struct Checkpoint {
+    LinReg::TrainingState state;
+    double learning_rate;
+    std::vector<uint32_t> train_order;
+    uint32_t data_hash;
+};
+
+namespace detail {
+
+constexpr uint32_t kCheckpointMagic{0x3243524C}; /* "LRC2" in little-endian. */
+
+/********************************************************************************
+ * @brief Updates specified FNV-1a hash with specified bytes.
+ ********************************************************************************/
+inline uint32_t Fnv1a(const void* data, const size_t size, uint32_t hash = 2166136261U) {
+    const auto bytes{static_cast<const uint8_t*>(data)};
+    for (size_t i{}; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    return hash;
+}
+
+/********************************************************************************
+ * @brief Serializes specified checkpoint into specified buffer.
+ ********************************************************************************/
+inline void Serialize(const Checkpoint& checkpoint, std::vector<uint8_t>& buffer) {
+    const auto append{[&](const void* data, const size_t size) {
+        const auto bytes{static_cast<const uint8_t*>(data)};
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }};
+    const auto num_sets{static_cast<uint32_t>(checkpoint.train_order.size())};
+    buffer.clear();
+    append(&kCheckpointMagic, sizeof(kCheckpointMagic));
+    append(&num_sets, sizeof(num_sets));
+    append(&checkpoint.data_hash, sizeof(checkpoint.data_hash));
+    append(&checkpoint.state.epoch, sizeof(checkpoint.state.epoch));
+    append(&checkpoint.state.random_state, sizeof(checkpoint.state.random_state));
+    append(&checkpoint.state.parameters.weight, sizeof(checkpoint.state.parameters.weight));
+    append(&checkpoint.state.parameters.bias, sizeof(checkpoint.state.parameters.bias));
+    append(&checkpoint.learning_rate, sizeof(checkpoint.learning_rate));
+    append(checkpoint.train_order.data(), num_sets * sizeof(uint32_t));
+    const auto checksum{Fnv1a(buffer.data(), buffer.size())};
+    append(&checksum, sizeof(checksum));
+}
+
+} /* namespace detail */
+
+/********************************************************************************
+ * @brief Calculates a hash of the training data of specified model, i.e. of the
+ *        input and reference values and the sample weights (if any).
+ *
+ * @param model
+ *        Reference to the model.
+ * @return
+ *        The FNV-1a hash of the training data.
+ ********************************************************************************/
+inline uint32_t HashTrainingData(const LinReg& model) {
+    const auto& input{model.TrainingInput()};
+    const auto& reference{model.TrainingOutput()};
+    const auto& weights{model.SampleWeights()};
+    auto hash{detail::Fnv1a(input.Data(), input.Size() * sizeof(double))};
+    hash = detail::Fnv1a(reference.Data(), reference.Size() * sizeof(double), hash);
+    return detail::Fnv1a(weights.Data(), weights.Size() * sizeof(double), hash);
+}
+
+/********************************************************************************
+ * @brief Creates a checkpoint of specified model.
+ *
+ * @param model
+ *        Reference to the model.
+ * @param learning_rate
+ *        The learning rate of the training.
+ * @param data_hash
+ *        The hash of the training data of the model, see HashTrainingData.
+ *        Passing it avoids hashing the training data for every checkpoint.
+ * @return
+ *        The checkpoint.
+ ********************************************************************************/
+inline Checkpoint MakeCheckpoint(const LinReg& model, const double learning_rate,
+                                 const uint32_t data_hash) {
+    const auto& order{model.TrainingOrder()};
+    return {model.GetTrainingState(), learning_rate,
+            std::vector<uint32_t>(order.begin(), order.end()), data_hash};
+}
+
+/********************************************************************************
+ * @brief Creates a checkpoint of specified model.
+ *
+ * @param model
+ *        Reference to the model.
+ * @param learning_rate
+ *        The learning rate of the training.
+ * @return
+ *        The checkpoint.
+ ********************************************************************************/
+inline Checkpoint MakeCheckpoint(const LinReg& model, const double learning_rate) {
+    return MakeCheckpoint(model, learning_rate, HashTrainingData(model));
+}
+
+/********************************************************************************
+ * @brief Writes specified checkpoint to specified file. The checkpoint is
+ *        written to a temporary file, which replaces the file when complete.
+ *
+ * @param path
+ *        The path of the checkpoint file.
+ * @param checkpoint
+ *        Reference to the checkpoint to write.
+ * @return
+ *        True if the checkpoint was written, else false.
+ ********************************************************************************/
+inline bool WriteCheckpoint(const std::string& path, const Checkpoint& checkpoint) {
+    std::vector<uint8_t> buffer{};
+    detail::Serialize(checkpoint, buffer);
+    const auto temp_path{path + ".tmp"};
+    auto file{std::fopen(temp_path.c_str(), "wb")};
+    if (file == nullptr) return false;
+    const auto written{std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size()};
+    if (std::fclose(file) != 0 || !written) return false;
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+/********************************************************************************
+ * @brief Reads checkpoint from specified file.
+ *
+ * @param path
+ *        The path of the checkpoint file.
+ * @param checkpoint
+ *        Reference to the checkpoint to read into.
+ * @return
+ *        True if a valid checkpoint was read, false if the file is missing,
+ *        truncated or corrupt.
+ ********************************************************************************/
+inline bool ReadCheckpoint(const std::string& path, Checkpoint& checkpoint) {
+    auto file{std::fopen(path.c_str(), "rb")};
+    if (file == nullptr) return false;
+    std::vector<uint8_t> buffer{};
+    uint8_t chunk[4096];
+    size_t size{};
+    while ((size = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        buffer.insert(buffer.end(), chunk, chunk + size);
+    }
+    std::fclose(file);
+
+    constexpr size_t kHeaderSize{5 * sizeof(uint32_t) + 3 * sizeof(double)};
+    if (buffer.size() < kHeaderSize + sizeof(uint32_t)) return false;
+    size_t offset{};
+    const auto read{[&](void* data, const size_t size) {
+        std::memcpy(data, buffer.data() + offset, size);
+        offset += size;
+    }};
+    uint32_t magic{}, num_sets{}, checksum{};
+    read(&magic, sizeof(magic));
+    read(&num_sets, sizeof(num_sets));
+    if (magic != detail::kCheckpointMagic ||
+        buffer.size() != kHeaderSize + (num_sets + 1) * sizeof(uint32_t)) {
+        return false;
+    }
+    std::memcpy(&checksum, buffer.data() + buffer.size() - sizeof(checksum), sizeof(checksum));
+    if (checksum != detail::Fnv1a(buffer.data(), buffer.size() - sizeof(checksum))) return false;
+
+    read(&checkpoint.data_hash, sizeof(checkpoint.data_hash));
+    read(&checkpoint.state.epoch, sizeof(checkpoint.state.epoch));
+    read(&checkpoint.state.random_state, sizeof(checkpoint.state.random_state));
+    read(&checkpoint.state.parameters.weight, sizeof(checkpoint.state.parameters.weight));
+    read(&checkpoint.state.parameters.bias, sizeof(checkpoint.state.parameters.bias));
+    read(&checkpoint.learning_rate, sizeof(checkpoint.learning_rate));
+    checkpoint.train_order.resize(num_sets);
+    read(checkpoint.train_order.data(), num_sets * sizeof(uint32_t));
+    return true;
+}
+
+/********************************************************************************
+ * @brief Restores the training state of specified model from checkpoint.
+ *
+ * @param model
+ *        Reference to the model, holding the same training data as when the
+ *        checkpoint was created.
+ * @param checkpoint
+ *        Reference to the checkpoint to restore.
+ * @return
+ *        True if the state was restored, false if the checkpoint doesn't match
+ *        the training data of the model, i.e. if the hash of the training data
+ *        differs or the training order doesn't fit the stored sets.
+ ********************************************************************************/
+inline bool RestoreCheckpoint(LinReg& model, const Checkpoint& checkpoint) {
+    if (checkpoint.data_hash != HashTrainingData(model)) return false;
+    const std::vector<size_t> order(checkpoint.train_order.begin(), checkpoint.train_order.end());
+    return model.RestoreTrainingState(checkpoint.state, order.data(), order.size());
+}
+
+/********************************************************************************
+ * @brief Class writing checkpoints to file in a background thread. Submitting
+ *        a checkpoint only moves it to a pending slot, so the training isn't
+ *        stalled by the disk. If a new checkpoint is submitted before the
+ *        pending one is written, the pending one is replaced, since only the
+ *        latest checkpoint matters.
+ ********************************************************************************/
+class CheckpointWriter {
+  public:
+
+    /********************************************************************************
+     * @brief Creates checkpoint writer for specified file.
+     *
+     * @param path
+     *        The path of the checkpoint file.
+     ********************************************************************************/
+    explicit CheckpointWriter(std::string path)
+        : path_{std::move(path)}, thread_{[this] { Run(); }} {}
+
+    /********************************************************************************
+     * @brief Writes any pending checkpoint, then stops the background thread.
+     ********************************************************************************/
+    ~CheckpointWriter(void) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        changed_.notify_all();
+        thread_.join();
+    }
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    /********************************************************************************
+     * @brief Submits specified checkpoint for writing.
+     *
+     * @param checkpoint
+     *        The checkpoint to write.
+     ********************************************************************************/
+    void Submit(Checkpoint checkpoint) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            pending_ = std::move(checkpoint);
+            has_pending_ = true;
+        }
+        changed_.notify_all();
+    }
+
+    /********************************************************************************
+     * @brief Blocks until the pending checkpoint (if any) has been written.
+     *
+     * @return
+     *        True if all checkpoints so far were written successfully.
+     ********************************************************************************/
+    bool Flush(void) {
+        std::unique_lock<std::mutex> lock{mutex_};
+        changed_.wait(lock, [this] { return !has_pending_ && !writing_; });
+        return !failed_;
+    }
+
+    /********************************************************************************
+     * @brief Provides the number of checkpoints written to file.
+     ********************************************************************************/
+    size_t NumWritten(void) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return num_written_;
+    }
+
+  private:
+    std::string path_;
+    Checkpoint pending_{};
+    std::mutex mutex_{};
+    std::condition_variable changed_{};
+    size_t num_written_{};
+    bool has_pending_{};
+    bool writing_{};
+    bool failed_{};
+    bool stop_{};
+    std::thread thread_;
+
+    /********************************************************************************
+     * @brief Writes pending checkpoints until stopped.
+     ********************************************************************************/
+    void Run(void) {
+        std::unique_lock<std::mutex> lock{mutex_};
+        while (true) {
+            changed_.wait(lock, [this] { return stop_ || has_pending_; });
+            if (!has_pending_) return;
+            auto checkpoint{std::move(pending_)};
+            has_pending_ = false;
+            writing_ = true;
+            lock.unlock();
+            const auto written{WriteCheckpoint(path_, checkpoint)};
+            lock.lock();
+            writing_ = false;
+            if (written) {
+                num_written_++;
+            } else {
+                failed_ = true;
+            }
+            changed_.notify_all();
+        }
+    }
+};
+
+/********************************************************************************
+ * @brief Trains specified model until the specified number of epochs has been
+ *        trained, with a checkpoint every interval epochs and after the last
+ *        epoch. If a valid checkpoint exists, the training is resumed from it.
+ *        A checkpoint made with other training data or another learning rate
+ *        is neither resumed nor overwritten, the training then fails instead.
+ *
+ * @param model
+ *        Reference to the model, holding the training data.
+ * @param num_epochs
+ *        The total number of epochs to train, including resumed epochs.
+ * @param learning_rate
+ *        The learning rate.
+ * @param path
+ *        The path of the checkpoint file.
+ * @param interval
+ *        The number of epochs between checkpoints (default = 10).
+ * @return
+ *        True if the training was completed and all checkpoints were written,
+ *        false if an existing checkpoint couldn't be restored (the model is then
+ *        left untrained) or a checkpoint couldn't be written.
+ ********************************************************************************/
+inline bool TrainWithCheckpoints(LinReg& model, const uint32_t num_epochs,
+                                 const double learning_rate, const std::string& path,
+                                 const uint32_t interval = 10) {
+    const auto data_hash{HashTrainingData(model)};
+    Checkpoint checkpoint{};
+    if (ReadCheckpoint(path, checkpoint) &&
+        (checkpoint.learning_rate != learning_rate || !RestoreCheckpoint(model, checkpoint))) {
+        return false;
+    }
+    CheckpointWriter writer{path};
+    while (model.GetTrainingState().epoch < num_epochs) {
+        model.Train(1, learning_rate);
+        const auto epoch{model.GetTrainingState().epoch};
+        if (interval > 0 && (epoch % interval == 0 || epoch == num_epochs)) {
+            writer.Submit(MakeCheckpoint(model, learning_rate, data_hash));
+        }
+    }
+    return writer.Flush();
+}
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,121 @@
+/********************************************************************************
+ * @brief Host simulation of a sensor whose transfer curve starts drifting
+ *        halfway through its life. The model is monitored by DriftMonitor and
+ *        retrained a few epochs per main loop iteration once drift is
+ *        confirmed. The CPU spent on training and the prediction error are
+ *        compared with retraining periodically and with never retraining.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/drift_demo.cpp drift_monitor.cpp \
+ *                lin_reg.cpp training_telemetry.cpp -o drift_demo
+ ********************************************************************************/
+#include <drift_monitor.hpp>
+
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumReadings{20000};
+constexpr size_t kDriftStart{10000};
+constexpr size_t kNumTrainSets{200};
+constexpr uint16_t kEpochsPerStep{5};
+constexpr uint16_t kRetrainEpochs{100};
+constexpr size_t kPeriodicInterval{500};
+constexpr double kLearningRate{0.005};
+constexpr double kNoise{0.5};
+
+/********************************************************************************
+ * @brief The true transfer curve of the sensor, where the gain starts drifting
+ *        at kDriftStart and has increased by 10 % at the end.
+ ********************************************************************************/
+double TransferCurve(const size_t reading, const double x) {
+    const auto drift{reading < kDriftStart ? 0.0 : 
+                     0.1 * (reading - kDriftStart) / (kNumReadings - kDriftStart)};
+    return 20.0 * (1.0 + drift) * x - 50.0;
+}
+
+/********************************************************************************
+ * @brief Creates model trained on the initial calibration data.
+ ********************************************************************************/
+void Calibrate(LinReg& model, std::mt19937& generator) {
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, kNoise};
+    model.SetRandomSeed(1);
+    model.SetTrainingCapacity(kNumTrainSets, LinReg::Sampling::kDecayed);
+    for (size_t i{}; i < kNumTrainSets; ++i) {
+        const auto x{input(generator)};
+        model.AddTrainingSample(x, TransferCurve(0, x) + noise(generator));
+    }
+    model.Train(500, kLearningRate);
+}
+
+/********************************************************************************
+ * @brief Struct holding the outcome of a simulation.
+ ********************************************************************************/
+struct Outcome {
+    size_t epochs;
+    double mse_before_drift;
+    double mse_after_drift;
+    size_t first_detection;
+    size_t num_drifts;
+};
+
+/********************************************************************************
+ * @brief Simulates the sensor life with specified retraining strategy, where
+ *        0 = never, 1 = periodic, 2 = drift monitor.
+ ********************************************************************************/
+Outcome Simulate(const int strategy) {
+    std::mt19937 generator{42};
+    LinReg model{};
+    Calibrate(model, generator);
+    DriftMonitor monitor{model, kRetrainEpochs, kLearningRate};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, kNoise};
+    Outcome outcome{0, 0.0, 0.0, 0, 0};
+
+    for (size_t i{}; i < kNumReadings; ++i) {
+        const auto x{input(generator)};
+        const auto reference{TransferCurve(i, x) + noise(generator)};
+        const auto error{TransferCurve(i, x) - model.Predict(x)};
+        (i < kDriftStart ? outcome.mse_before_drift : outcome.mse_after_drift) += error * error;
+
+        if (strategy == 2) {
+            monitor.AddReference(x, reference);
+            if (monitor.RetrainStep(kEpochsPerStep)) outcome.epochs += kEpochsPerStep;
+            if (monitor.NumDrifts() > 0 && outcome.first_detection == 0) outcome.first_detection = i;
+        } else if (strategy == 1) {
+            model.AddTrainingSample(x, reference);
+            if ((i + 1) % kPeriodicInterval == 0) {
+                model.Train(kRetrainEpochs, kLearningRate);
+                outcome.epochs += kRetrainEpochs;
+            }
+        }
+    }
+    outcome.mse_before_drift /= kDriftStart;
+    outcome.mse_after_drift /= kNumReadings - kDriftStart;
+    outcome.num_drifts = monitor.NumDrifts();
+    return outcome;
+}
+
+} /* namespace */
+
+int main(void) {
+    const char* names[]{"Never retrain", "Periodic", "Drift monitor"};
+    std::printf("%zu readings, gain drifts +10 %% from reading %zu, noise sigma %.1f\n",
+                kNumReadings, kDriftStart, kNoise);
+    for (int strategy{}; strategy < 3; ++strategy) {
+        const auto outcome{Simulate(strategy)};
+        std::printf("%-14s epochs %6zu, model MSE before drift %.4f, after drift %.4f", 
+                    names[strategy], outcome.epochs, outcome.mse_before_drift, outcome.mse_after_drift);
+        if (strategy == 2) {
+            std::printf(", %zu drifts, first at reading %zu", outcome.num_drifts, outcome.first_detection);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/********************************************************************************
+ * @brief Host-side parallel evaluation of the LinReg class on large datasets.
+ *        The data is split into contiguous chunks, the partial sums of each
+ *        chunk are calculated on a thread pool and merged into the metrics.
+ *
+ *        Host only (requires threads), not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+#include <host/thread_pool.hpp>
+
+#include <vector>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Evaluates specified model on specified data in parallel. The result
+ *        equals LinReg::Evaluate up to floating-point rounding.
+ *
+ * @param model
+ *        Reference to the model to evaluate.
+ * @param input
+ *        Pointer to array containing input data (x).
+ * @param reference
+ *        Pointer to array containing reference data (y_ref).
+ * @param num_sets
+ *        The number of sets to evaluate.
+ * @param pool
+ *        Reference to the thread pool to run the chunks on.
+ * @param chunk_size
+ *        The number of sets per chunk (default = 65536).
+ * @return
+ *        The metrics of the model (all zero if no sets are specified).
+ ********************************************************************************/
+inline LinReg::Metrics Evaluate(const LinReg& model, const double* input, const double* reference,
+                                const size_t num_sets, ThreadPool& pool,
+                                const size_t chunk_size = 65536) {
+    if (num_sets == 0 || chunk_size == 0) return LinReg::Metrics{};
+    const auto shift{reference[0]};
+    const auto num_chunks{(num_sets + chunk_size - 1) / chunk_size};
+    std::vector<LinReg::ErrorSums> sums(num_chunks);
+
+    for (size_t i{}; i < num_chunks; ++i) {
+        pool.Submit([&, i] {
+            const auto first{i * chunk_size};
+            const auto size{first + chunk_size < num_sets ? chunk_size : num_sets - first};
+            sums[i] = model.Accumulate(input + first, reference + first, size, shift);
+        });
+    }
+    pool.Wait();
+
+    for (size_t i{1}; i < num_chunks; ++i) {
+        LinReg::Merge(sums[0], sums[i]);
+    }
+    return LinReg::Finalize(sums[0]);
+}
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
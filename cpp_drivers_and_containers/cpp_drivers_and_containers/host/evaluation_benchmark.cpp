@@ -0,0 +1,94 @@
+/********************************************************************************
+ * @brief Host benchmark comparing calculation of MSE, RMSE, MAE, max error and
+ *        R^2 with one loop (and one Predict call) per metric against the fused
+ *        single-pass LinReg::Evaluate and its parallel variant.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O3 -std=c++17 -pthread -I. host/evaluation_benchmark.cpp \
+ *                lin_reg.cpp training_telemetry.cpp -o evaluation_benchmark
+ ********************************************************************************/
+#include <host/evaluation.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSets{4000000};
+constexpr size_t kNumRuns{10};
+
+/********************************************************************************
+ * @brief Calculates the metrics with a separate loop per metric, as done by
+ *        hand before LinReg::Evaluate existed.
+ ********************************************************************************/
+LinReg::Metrics SeparateLoops(const LinReg& model, const Vector<double>& x, const Vector<double>& y) {
+    const auto n{y.Size()};
+    LinReg::Metrics metrics{};
+    for (size_t i{}; i < n; ++i) {
+        const auto error{y[i] - model.Predict(x[i])};
+        metrics.mse += error * error;
+    }
+    metrics.mse /= n;
+    metrics.rmse = std::sqrt(metrics.mse);
+    for (size_t i{}; i < n; ++i) {
+        metrics.mae += std::fabs(y[i] - model.Predict(x[i]));
+    }
+    metrics.mae /= n;
+    for (size_t i{}; i < n; ++i) {
+        metrics.max_error = std::fmax(metrics.max_error, std::fabs(y[i] - model.Predict(x[i])));
+    }
+    double mean{}, ss_tot{};
+    for (size_t i{}; i < n; ++i) {
+        mean += y[i];
+    }
+    mean /= n;
+    for (size_t i{}; i < n; ++i) {
+        ss_tot += (y[i] - mean) * (y[i] - mean);
+    }
+    metrics.r2 = 1.0 - metrics.mse * n / ss_tot;
+    return metrics;
+}
+
+/********************************************************************************
+ * @brief Runs specified evaluation kNumRuns times and prints the mean time.
+ ********************************************************************************/
+template <typename Function>
+void Measure(const char* name, Function evaluate) {
+    LinReg::Metrics metrics{};
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{}; i < kNumRuns; ++i) {
+        metrics = evaluate();
+    }
+    const auto ms{std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count() / kNumRuns};
+    std::printf("%-16s %8.2f ms  MSE %.6f RMSE %.6f MAE %.6f max %.6f R2 %.8f\n", name, ms,
+                metrics.mse, metrics.rmse, metrics.mae, metrics.max_error, metrics.r2);
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{3};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, 0.1};
+    Vector<double> x{kNumSets}, y{kNumSets};
+    for (size_t i{}; i < kNumSets; ++i) {
+        x[i] = input(generator);
+        y[i] = 20.0 * x[i] - 50.0 + noise(generator);
+    }
+    LinReg model{};
+    model.SetParameters({20.0, -50.0});
+    host::ThreadPool pool{};
+
+    Measure("Separate loops", [&] { return SeparateLoops(model, x, y); });
+    Measure("Fused", [&] { return model.Evaluate(x.Data(), y.Data(), kNumSets); });
+    Measure("Fused parallel", [&] { return host::Evaluate(model, x.Data(), y.Data(), kNumSets, pool); });
+    std::printf("(%zu worker threads)\n", pool.NumThreads());
+    return 0;
+}
\ No newline at end of file
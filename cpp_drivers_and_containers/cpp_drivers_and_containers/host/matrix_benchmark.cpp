@@ -0,0 +1,155 @@
+/********************************************************************************
+ * @brief Host benchmark of the container::Matrix kernels, comparing the
+ *        cache-blocked GEMM with a naive triple loop over the same storage and
+ *        timing GEMV, the transposed products and the Cholesky solve on the
+ *        normal equations of a least squares problem.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O3 -mavx2 -mfma -std=c++17 -I. host/matrix_benchmark.cpp \
+ *                -o matrix_benchmark
+ ********************************************************************************/
+#include <matrix.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kSize{512};
+constexpr size_t kNumSets{20000};
+constexpr size_t kNumFeatures{64};
+constexpr size_t kNumRuns{200};
+
+/********************************************************************************
+ * @brief Returns the time elapsed since specified start in ms.
+ ********************************************************************************/
+double ElapsedMs(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+/********************************************************************************
+ * @brief Fills specified matrix with random values.
+ ********************************************************************************/
+void Randomize(Matrix<double>& matrix, std::mt19937& generator) {
+    std::normal_distribution<double> value{0.0, 1.0};
+    for (size_t i{}; i < matrix.Rows(); ++i) {
+        for (size_t j{}; j < matrix.Cols(); ++j) {
+            matrix(i, j) = value(generator);
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Multiplies specified matrices with the textbook i-j-k loop, i.e. with
+ *        a column walk through B for every element of C.
+ ********************************************************************************/
+void MultiplyNaive(const Matrix<double>& a, const Matrix<double>& b, Matrix<double>& c) {
+    c.Resize(a.Rows(), b.Cols());
+    for (size_t i{}; i < a.Rows(); ++i) {
+        for (size_t j{}; j < b.Cols(); ++j) {
+            double sum{};
+            for (size_t p{}; p < a.Cols(); ++p) {
+                sum += a(i, p) * b(p, j);
+            }
+            c(i, j) = sum;
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Returns the largest absolute difference between specified matrices.
+ ********************************************************************************/
+double MaxDifference(const Matrix<double>& a, const Matrix<double>& b) {
+    double max{};
+    for (size_t i{}; i < a.Rows(); ++i) {
+        for (size_t j{}; j < a.Cols(); ++j) {
+            max = std::fmax(max, std::fabs(a(i, j) - b(i, j)));
+        }
+    }
+    return max;
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{17};
+    Matrix<double> a{kSize, kSize}, b{kSize, kSize}, c{}, reference{};
+    Randomize(a, generator);
+    Randomize(b, generator);
+    const auto gflops{[](const double ms) { return 2.0 * kSize * kSize * kSize / ms / 1e6; }};
+
+    auto start{std::chrono::steady_clock::now()};
+    MultiplyNaive(a, b, reference);
+    const auto naive_ms{ElapsedMs(start)};
+    start = std::chrono::steady_clock::now();
+    Multiply(a, b, c);
+    const auto blocked_ms{ElapsedMs(start)};
+    std::printf("GEMM %zux%zu:  naive %7.1f ms (%5.2f GFLOP/s), blocked %7.1f ms "
+                "(%5.2f GFLOP/s), %.1fx, max difference %.2e\n", kSize, kSize, naive_ms,
+                gflops(naive_ms), blocked_ms, gflops(blocked_ms), naive_ms / blocked_ms,
+                MaxDifference(c, reference));
+
+    start = std::chrono::steady_clock::now();
+    MultiplyTransposed(a, b, c);
+    const auto transposed_ms{ElapsedMs(start)};
+    std::printf("A * B^T %zux%zu:       %7.1f ms (%5.2f GFLOP/s)\n", kSize, kSize,
+                transposed_ms, gflops(transposed_ms));
+
+    std::vector<double> x(kSize, 1.0), y(kSize);
+    double checksum{};
+    start = std::chrono::steady_clock::now();
+    for (size_t run{}; run < kNumRuns; ++run) {
+        x[run % kSize] += 1e-3;
+        Multiply(a, x.data(), y.data());
+        checksum += y[0];
+    }
+    auto ms{ElapsedMs(start) / kNumRuns};
+    std::printf("GEMV A * x:            %7.3f ms (%5.2f GFLOP/s)\n", ms,
+                2.0 * kSize * kSize / ms / 1e6);
+    start = std::chrono::steady_clock::now();
+    for (size_t run{}; run < kNumRuns; ++run) {
+        x[run % kSize] += 1e-3;
+        MultiplyTransposed(a, x.data(), y.data());
+        checksum += y[0];
+    }
+    ms = ElapsedMs(start) / kNumRuns;
+    std::printf("GEMV A^T * x:          %7.3f ms (%5.2f GFLOP/s)\n", ms,
+                2.0 * kSize * kSize / ms / 1e6);
+
+    /* Least squares: the features are stored one per row, so the Gram matrix is
+       X * X^T and the right-hand side X * y. */
+    Matrix<double> features{kNumFeatures, kNumSets}, gram{};
+    Randomize(features, generator);
+    std::vector<double> weights(kNumFeatures), outputs(kNumSets), rhs(kNumFeatures);
+    std::normal_distribution<double> noise{0.0, 0.01};
+    for (size_t j{}; j < kNumFeatures; ++j) {
+        weights[j] = 0.5 * j / kNumFeatures - 0.25;
+    }
+    MultiplyTransposed(features, weights.data(), outputs.data());
+    for (auto& output : outputs) {
+        output += noise(generator);
+    }
+    start = std::chrono::steady_clock::now();
+    MultiplyTransposed(features, features, gram);
+    Multiply(features, outputs.data(), rhs.data());
+    const auto gram_ms{ElapsedMs(start)};
+    start = std::chrono::steady_clock::now();
+    const auto solved{CholeskySolve(gram, rhs.data())};
+    const auto solve_ms{ElapsedMs(start)};
+    double max_error{};
+    for (size_t j{}; j < kNumFeatures; ++j) {
+        max_error = std::fmax(max_error, std::fabs(rhs[j] - weights[j]));
+    }
+    std::printf("Least squares %zu sets x %zu features: normal equations %.2f ms, "
+                "Cholesky %.3f ms, %s, max weight error %.2e\n", kNumSets, kNumFeatures,
+                gram_ms, solve_ms, solved ? "solved" : "not solved", max_error);
+    std::printf("(checksum %.3f)\n", checksum);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+/********************************************************************************
+ * @brief Host-side mixed-precision training and evaluation kernels for the
+ *        LinReg class. The data can be stored as float instead of double,
+ *        which halves the memory traffic and doubles the number of values per
+ *        SIMD register (8 instead of 4 with AVX2).
+ *
+ *        The per-set arithmetic is done in the precision of the data, while
+ *        every reduction is summed in short blocks and each block sum is added
+ *        to a double accumulator, so the rounding error doesn't grow with the
+ *        number of sets. The model parameters are always kept in double.
+ *
+ *        The training is mini-batch gradient descent, since the per-set updates
+ *        of LinReg::Train depend on each other and can't be vectorized. The
+ *        data should be shuffled beforehand, since the batches are contiguous.
+ *
+ *        The kernels are plain loops over one register of lanes, which the
+ *        compiler vectorizes without -ffast-math. Build with -O3 -mavx2 -mfma to
+ *        get AVX2 code.
+ *
+ *        Host only, not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+
+#include <vector>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Struct holding the sums over a batch of sets.
+ *
+ * @param sum_errors
+ *        The sum of errors (y_ref - y_pred), i.e. the bias gradient.
+ * @param sum_weighted_errors
+ *        The sum of errors multiplied by the input, i.e. the weight gradient.
+ * @param sum_squares
+ *        The sum of squared errors (only calculated if requested).
+ ********************************************************************************/
+struct BatchSums {
+    double sum_errors;
+    double sum_weighted_errors;
+    double sum_squares;
+};
+
+/********************************************************************************
+ * @brief Calculates the sums over specified sets with the specified parameters.
+ *
+ * @tparam T
+ *        The type of the data (float or double).
+ * @tparam kCalculateLoss
+ *        True to also sum the squared errors.
+ * @param parameters
+ *        The parameters to calculate the errors with.
+ * @param input
+ *        Pointer to array containing input data (x).
+ * @param reference
+ *        Pointer to array containing reference data (y_ref).
+ * @param num_sets
+ *        The number of sets.
+ * @return
+ *        The sums over the sets.
+ ********************************************************************************/
+template <typename T, bool kCalculateLoss = false>
+inline BatchSums Accumulate(const LinReg::Parameters& parameters, const T* input,
+                            const T* reference, const size_t num_sets) {
+    constexpr size_t kLanes{32 / sizeof(T)};
+    constexpr size_t kBlockSize{1024};
+    const auto weight{static_cast<T>(parameters.weight)};
+    const auto bias{static_cast<T>(parameters.bias)};
+    BatchSums sums{0.0, 0.0, 0.0};
+
+    for (size_t first{}; first < num_sets; first += kBlockSize) {
+        const auto x{input + first};
+        const auto y{reference + first};
+        const auto count{first + kBlockSize < num_sets ? kBlockSize : num_sets - first};
+        T errors[kLanes]{}, weighted_errors[kLanes]{}, squares[kLanes]{};
+        size_t i{};
+        for (; i + kLanes <= count; i += kLanes) {
+            for (size_t j{}; j < kLanes; ++j) {
+                const T error{y[i + j] - (weight * x[i + j] + bias)};
+                errors[j] += error;
+                weighted_errors[j] += error * x[i + j];
+                if (kCalculateLoss) squares[j] += error * error;
+            }
+        }
+        for (; i < count; ++i) {
+            const T error{y[i] - (weight * x[i] + bias)};
+            errors[0] += error;
+            weighted_errors[0] += error * x[i];
+            if (kCalculateLoss) squares[0] += error * error;
+        }
+        for (size_t j{}; j < kLanes; ++j) {
+            sums.sum_errors += errors[j];
+            sums.sum_weighted_errors += weighted_errors[j];
+            sums.sum_squares += squares[j];
+        }
+    }
+    return sums;
+}
+
+/********************************************************************************
+ * @brief Trains specified model with mini-batch gradient descent, starting from
+ *        its current parameters. The mean gradient of each batch is applied
+ *        after the batch.
+ *
+ * @tparam T
+ *        The type of the data (float or double).
+ * @param model
+ *        Reference to the model to train.
+ * @param input
+ *        Pointer to array containing input data (x).
+ * @param reference
+ *        Pointer to array containing reference data (y_ref).
+ * @param num_sets
+ *        The number of sets.
+ * @param batch_size
+ *        The number of sets per batch.
+ * @param num_epochs
+ *        The number of passes over all sets.
+ * @param learning_rate
+ *        The learning rate.
+ ********************************************************************************/
+template <typename T>
+inline void TrainBatches(LinReg& model, const T* input, const T* reference, const size_t num_sets,
+                         const size_t batch_size, const size_t num_epochs,
+                         const double learning_rate) {
+    if (batch_size == 0) return;
+    auto parameters{model.GetParameters()};
+    for (size_t epoch{}; epoch < num_epochs; ++epoch) {
+        for (size_t first{}; first < num_sets; first += batch_size) {
+            const auto count{first + batch_size < num_sets ? batch_size : num_sets - first};
+            const auto sums{Accumulate(parameters, input + first, reference + first, count)};
+            parameters.weight += learning_rate * sums.sum_weighted_errors / count;
+            parameters.bias += learning_rate * sums.sum_errors / count;
+        }
+    }
+    model.SetParameters(parameters);
+}
+
+/********************************************************************************
+ * @brief Calculates the mean squared error of specified model on specified sets.
+ *
+ * @tparam T
+ *        The type of the data (float or double).
+ * @return
+ *        The mean squared error (0 if no sets are specified).
+ ********************************************************************************/
+template <typename T>
+inline double MeanSquaredError(const LinReg& model, const T* input, const T* reference,
+                               const size_t num_sets) {
+    if (num_sets == 0) return 0.0;
+    return Accumulate<T, true>(model.GetParameters(), input, reference, num_sets).sum_squares /
+        num_sets;
+}
+
+/********************************************************************************
+ * @brief Converts specified values to float.
+ ********************************************************************************/
+inline std::vector<float> ToFloat(const double* values, const size_t num_values) {
+    return std::vector<float>(values, values + num_values);
+}
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,98 @@
+/********************************************************************************
+ * @brief Host benchmark comparing the float and double kernels of
+ *        host/mixed_precision.hpp, both in throughput (gradient and MSE passes)
+ *        and in accuracy (trained parameters and MSE against the closed-form
+ *        LinReg::Fit on the double data).
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O3 -mavx2 -mfma -std=c++17 -I. host/mixed_precision_benchmark.cpp \
+ *                lin_reg.cpp training_telemetry.cpp -o mixed_precision_benchmark
+ ********************************************************************************/
+#include <host/mixed_precision.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSets{4000000};
+constexpr size_t kNumRuns{20};
+constexpr size_t kBatchSize{4096};
+constexpr size_t kNumEpochs{5};
+constexpr double kLearningRate{0.1};
+
+/********************************************************************************
+ * @brief Returns the throughput of a gradient pass in million sets per second.
+ ********************************************************************************/
+template <typename T>
+double Throughput(const T* x, const T* y, double& checksum) {
+    const LinReg::Parameters parameters{19.0, -49.0};
+    const auto start{std::chrono::steady_clock::now()};
+    for (size_t i{}; i < kNumRuns; ++i) {
+        checksum += host::Accumulate(parameters, x, y, kNumSets).sum_weighted_errors;
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    return kNumSets * kNumRuns / elapsed.count() / 1e6;
+}
+
+/********************************************************************************
+ * @brief Trains a new model on the specified data and returns the time in ms.
+ ********************************************************************************/
+template <typename T>
+double Train(LinReg& model, const T* x, const T* y) {
+    const auto start{std::chrono::steady_clock::now()};
+    host::TrainBatches(model, x, y, kNumSets, kBatchSize, kNumEpochs, kLearningRate);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{13};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, 0.1};
+    Vector<double> x{kNumSets}, y{kNumSets};
+    for (size_t i{}; i < kNumSets; ++i) {
+        x[i] = input(generator);
+        y[i] = 20.0 * x[i] - 50.0 + noise(generator);
+    }
+    const auto x_float{host::ToFloat(x.Data(), kNumSets)};
+    const auto y_float{host::ToFloat(y.Data(), kNumSets)};
+
+    double checksum{};
+    const auto double_rate{Throughput(x.Data(), y.Data(), checksum)};
+    const auto float_rate{Throughput(x_float.data(), y_float.data(), checksum)};
+    std::printf("Gradient pass: double %.0f Msets/s, float %.0f Msets/s (%.2fx)\n", double_rate,
+                float_rate, float_rate / double_rate);
+
+    LinReg closed_form{x, y};
+    closed_form.Fit();
+    LinReg double_model{}, float_model{};
+    const auto double_ms{Train(double_model, x.Data(), y.Data())};
+    const auto float_ms{Train(float_model, x_float.data(), y_float.data())};
+    std::printf("Training (%zu epochs, batches of %zu): double %.1f ms, float %.1f ms (%.2fx)\n",
+                kNumEpochs, kBatchSize, double_ms, float_ms, double_ms / float_ms);
+
+    const auto print{[&](const char* name, const LinReg& model) {
+        const auto parameters{model.GetParameters()};
+        std::printf("%-12s k=%.9f m=%.9f MSE=%.9f\n", name, parameters.weight, parameters.bias,
+                    host::MeanSquaredError(model, x.Data(), y.Data(), kNumSets));
+    }};
+    print("Closed form", closed_form);
+    print("Double", double_model);
+    print("Float", float_model);
+
+    const auto expected{double_model.GetParameters()}, actual{float_model.GetParameters()};
+    std::printf("Float vs double: |dk|=%.2e |dm|=%.2e, MSE on float data %.9f (checksum %g)\n",
+                std::fabs(actual.weight - expected.weight), std::fabs(actual.bias - expected.bias),
+                host::MeanSquaredError(float_model, x_float.data(), y_float.data(), kNumSets),
+                checksum);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+/********************************************************************************
+ * @brief Host tool training a LinReg model from a logged dataset and emitting
+ *        the result as a constexpr C++ header for the firmware, so the model
+ *        doesn't have to be trained (or its coefficients copied by hand) on
+ *        the device.
+ *
+ *        The dataset is a text file with one "x,y" set per line (lines that
+ *        don't start with a number, e.g. a CSV header or comments, are skipped).
+ *        The header holds the weight and bias as LinReg::Parameters and,
+ *        optionally, a lookup table from ADC codes to fixed-point outputs with
+ *        an integer-only interpolation function, for targets where floating
+ *        point is too slow.
+ *
+ *        main.cpp uses generated_model.hpp instead of training on the device if
+ *        the file exists in the project directory.
+ *
+ *        Build on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/model_codegen.cpp lin_reg.cpp \
+ *                training_telemetry.cpp -o model_codegen
+ *
+ *        Usage:
+ *
+ *            model_codegen <dataset> [options]
+ *
+ *            --output <path>      Header to write (default = generated_model.hpp).
+ *            --name <name>        Name of the model constants (default = TempModel).
+ *            --fit <method>       closed (least squares, default), robust (Huber)
+ *                                 or sgd.
+ *            --threshold <value>  Huber threshold for robust fitting (default = 1).
+ *            --epochs <count>     Number of epochs for sgd (default = 1000).
+ *            --rate <value>       Learning rate for sgd (default = 0.01).
+ *            --table <entries>    Number of lookup table entries (default = 0, none).
+ *            --codes <max> <scale>
+ *                                 Largest ADC code and input value per code for
+ *                                 the table (default = 1023 and 5/1023).
+ *            --decimals <count>   Table values in units of 10^-count (default = 1).
+ ********************************************************************************/
+#include <lin_reg.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+/********************************************************************************
+ * @brief Struct holding the options of the tool.
+ ********************************************************************************/
+struct Options {
+    std::string dataset;
+    std::string output{"generated_model.hpp"};
+    std::string name{"TempModel"};
+    std::string fit{"closed"};
+    double threshold{1.0};
+    size_t epochs{1000};
+    double rate{0.01};
+    size_t table_entries{};
+    uint32_t max_code{1023};
+    double code_scale{5.0 / 1023};
+    uint32_t decimals{1};
+};
+
+/********************************************************************************
+ * @brief Parses the command line arguments into specified options.
+ *
+ * @return
+ *        True if the arguments are valid, else false.
+ ********************************************************************************/
+bool ParseOptions(const int argc, char** argv, Options& options) {
+    for (int i{1}; i < argc; ++i) {
+        const std::string argument{argv[i]};
+        const auto has_value{[&](const int count) { return i + count < argc; }};
+        if (argument == "--output" && has_value(1)) {
+            options.output = argv[++i];
+        } else if (argument == "--name" && has_value(1)) {
+            options.name = argv[++i];
+        } else if (argument == "--fit" && has_value(1)) {
+            options.fit = argv[++i];
+        } else if (argument == "--threshold" && has_value(1)) {
+            options.threshold = std::atof(argv[++i]);
+        } else if (argument == "--epochs" && has_value(1)) {
+            options.epochs = std::strtoul(argv[++i], nullptr, 10);
+        } else if (argument == "--rate" && has_value(1)) {
+            options.rate = std::atof(argv[++i]);
+        } else if (argument == "--table" && has_value(1)) {
+            options.table_entries = std::strtoul(argv[++i], nullptr, 10);
+        } else if (argument == "--codes" && has_value(2)) {
+            options.max_code = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            options.code_scale = std::atof(argv[++i]);
+        } else if (argument == "--decimals" && has_value(1)) {
+            options.decimals = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (options.dataset.empty() && argument[0] != '-') {
+            options.dataset = argument;
+        } else {
+            std::fprintf(stderr, "Invalid argument: %s\n", argument.c_str());
+            return false;
+        }
+    }
+    if (options.dataset.empty()) {
+        std::fprintf(stderr, "No dataset specified!\n");
+        return false;
+    }
+    if (options.table_entries == 1 || options.table_entries > options.max_code + 1) {
+        std::fprintf(stderr, "The table needs 2 - %u entries!\n", options.max_code + 1);
+        return false;
+    }
+    return options.fit == "closed" || options.fit == "robust" || options.fit == "sgd";
+}
+
+/********************************************************************************
+ * @brief Reads the "x,y" sets of specified dataset file.
+ *
+ * @return
+ *        True if the file was read, else false.
+ ********************************************************************************/
+bool ReadDataset(const std::string& path, Vector<double>& train_in, Vector<double>& train_out) {
+    auto file{std::fopen(path.c_str(), "r")};
+    if (file == nullptr) return false;
+    char line[256]{};
+    while (std::fgets(line, sizeof(line), file) != nullptr) {
+        double x{}, y{};
+        if (std::sscanf(line, " %lf ,%lf", &x, &y) == 2 ||
+            std::sscanf(line, " %lf %lf", &x, &y) == 2) {
+            train_in.PushBack(x);
+            train_out.PushBack(y);
+        }
+    }
+    std::fclose(file);
+    return train_in.Size() > 0;
+}
+
+/********************************************************************************
+ * @brief Writes the header with the trained model to the output file.
+ *
+ * @return
+ *        True if the header was written, else false.
+ ********************************************************************************/
+bool WriteHeader(const Options& options, const LinReg& model, const size_t num_sets,
+                 const LinReg::Metrics& metrics) {
+    auto file{std::fopen(options.output.c_str(), "w")};
+    if (file == nullptr) return false;
+    const auto parameters{model.GetParameters()};
+    const auto name{options.name.c_str()};
+    const auto fit{options.fit == "closed" ? "closed-form least squares" :
+                   options.fit == "robust" ? "Huber regression" : "SGD"};
+
+    std::fprintf(file, "/************************************************************"
+                       "********************\n");
+    std::fprintf(file, " * @brief Model generated by host/model_codegen from %s\n",
+                 options.dataset.c_str());
+    std::fprintf(file, " *        (%zu sets, %s, RMSE %.6g, R^2 %.6f).\n", num_sets, fit,
+                 metrics.rmse, metrics.r2);
+    std::fprintf(file, " *        Don't edit, regenerate instead.\n");
+    std::fprintf(file, " ************************************************************"
+                       "********************/\n");
+    std::fprintf(file, "#pragma once\n\n#include <lin_reg.hpp>\n#include <stdint.h>\n\n");
+    std::fprintf(file, "namespace yrgo {\nnamespace generated {\n\n");
+    std::fprintf(file, "constexpr double k%sWeight{%.17g};\n", name, parameters.weight);
+    std::fprintf(file, "constexpr double k%sBias{%.17g};\n", name, parameters.bias);
+    std::fprintf(file, "constexpr LinReg::Parameters k%s{k%sWeight, k%sBias};\n", name, name,
+                 name);
+
+    if (options.table_entries > 0) {
+        const auto entries{options.table_entries};
+        const auto step{static_cast<uint32_t>((options.max_code + entries - 2) / (entries - 1))};
+        const auto unit{std::pow(10.0, options.decimals)};
+        std::fprintf(file, "\n/* Outputs in units of 10^-%u at codes 0, %u, %u, ...,\n"
+                           "   where the input is code * %.9g. */\n", options.decimals, step,
+                     2 * step, options.code_scale);
+        std::fprintf(file, "constexpr uint16_t k%sTableStep{%u};\n", name, step);
+        std::fprintf(file, "constexpr uint16_t k%sTableSize{%zu};\n", name, entries);
+        std::fprintf(file, "constexpr int32_t k%sTable[k%sTableSize]{", name, name);
+        for (size_t i{}; i < entries; ++i) {
+            const auto code{static_cast<double>(i * step)};
+            const auto output{std::lround(model.Predict(code * options.code_scale) * unit)};
+            std::fprintf(file, "%s%s%ld", i > 0 ? "," : "", i % 8 == 0 ? "\n    " : " ", output);
+        }
+        std::fprintf(file, "\n};\n\n");
+        std::fprintf(file, "/* Provides the output for specified code in units of 10^-%u,\n"
+                           "   interpolated between the table entries. */\n", options.decimals);
+        std::fprintf(file, "constexpr int32_t Lookup%s(const uint16_t code) {\n", name);
+        std::fprintf(file, "    const auto index{code / k%sTableStep < k%sTableSize - 1 ?\n"
+                           "        code / k%sTableStep : k%sTableSize - 2};\n", name, name, name,
+                     name);
+        std::fprintf(file, "    const int32_t offset{static_cast<int32_t>(code) - "
+                           "index * k%sTableStep};\n", name);
+        std::fprintf(file, "    return k%sTable[index] + (k%sTable[index + 1] - k%sTable[index]) "
+                           "*\n        offset / k%sTableStep;\n}\n", name, name, name, name);
+    }
+    std::fprintf(file, "\n} /* namespace generated */\n} /* namespace yrgo */\n");
+    return std::fclose(file) == 0;
+}
+
+} /* namespace */
+
+int main(int argc, char** argv) {
+    Options options{};
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s <dataset> [--output <path>] [--name <name>] "
+                             "[--fit closed|robust|sgd] [--threshold <value>] "
+                             "[--epochs <count>] [--rate <value>] [--table <entries>] "
+                             "[--codes <max> <scale>] [--decimals <count>]\n", argv[0]);
+        return 1;
+    }
+
+    Vector<double> train_in{}, train_out{};
+    if (!ReadDataset(options.dataset, train_in, train_out)) {
+        std::fprintf(stderr, "Couldn't read any sets from %s!\n", options.dataset.c_str());
+        return 1;
+    }
+    LinReg model{train_in, train_out};
+    bool fitted{true};
+    if (options.fit == "closed") {
+        fitted = model.Fit();
+    } else if (options.fit == "robust") {
+        fitted = model.FitRobust(options.threshold);
+    } else {
+        model.Train(options.epochs, options.rate);
+    }
+    if (!fitted) {
+        std::fprintf(stderr, "Couldn't fit the model, are all inputs equal?\n");
+        return 1;
+    }
+
+    const auto metrics{model.Evaluate()};
+    if (!WriteHeader(options, model, train_in.Size(), metrics)) {
+        std::fprintf(stderr, "Couldn't write %s!\n", options.output.c_str());
+        return 1;
+    }
+    const auto parameters{model.GetParameters()};
+    std::printf("%zu sets: k=%.9g m=%.9g, RMSE %.6g, R^2 %.6f -> %s\n", train_in.Size(),
+                parameters.weight, parameters.bias, metrics.rmse, metrics.r2,
+                options.output.c_str());
+    return 0;
+}
\ No newline at end of file
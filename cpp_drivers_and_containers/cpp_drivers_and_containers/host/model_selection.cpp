@@ -0,0 +1,56 @@
+/********************************************************************************
+ * @brief Host program selecting the number of epochs and learning rate for
+ *        LinReg::Train via parallel 5-fold cross-validation, first over a grid
+ *        and then over random configurations. The grid search is also run on a
+ *        single thread to show the speedup of the thread pool.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -pthread -I. host/model_selection.cpp \
+ *                lin_reg.cpp training_telemetry.cpp -o model_selection
+ ********************************************************************************/
+#include <host/model_selection.hpp>
+
+#include <cstdio>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSets{2000};
+constexpr size_t kNumFolds{5};
+
+/********************************************************************************
+ * @brief Prints the best configuration and the timings of specified result.
+ ********************************************************************************/
+void Print(const char* name, const host::SelectionResult& result) {
+    std::printf("%s: %zu configs x %zu folds on %zu threads\n", name, result.results.size(),
+                kNumFolds, result.num_threads);
+    std::printf("  best: %zu epochs, learning rate %.4f, validation MSE %.5f\n",
+                result.best.config.num_epochs, result.best.config.learning_rate,
+                result.best.mean_error);
+    std::printf("  wall %.1f ms, summed job time %.1f ms, speedup %.2f\n",
+                result.wall_ms, result.job_ms, result.job_ms / result.wall_ms);
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{7};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, 0.1};
+    Vector<double> train_in{kNumSets}, train_out{kNumSets};
+    for (size_t i{}; i < kNumSets; ++i) {
+        train_in[i] = input(generator);
+        train_out[i] = 20.0 * train_in[i] - 50.0 + noise(generator);
+    }
+
+    const auto grid{host::GridSearch({10, 20, 50, 100, 200}, {0.001, 0.003, 0.01, 0.03})};
+    Print("Grid, 1 thread", host::SelectModel(train_in, train_out, grid, kNumFolds, 1));
+    Print("Grid", host::SelectModel(train_in, train_out, grid, kNumFolds));
+
+    const auto random{host::RandomSearch(20, 10, 200, 0.0005, 0.05, 1)};
+    Print("Random", host::SelectModel(train_in, train_out, random, kNumFolds));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+/********************************************************************************
+ * @brief Host-side model selection for the LinReg class, i.e. k-fold
+ *        cross-validation over a set of hyperparameter configurations (number
+ *        of epochs and learning rate). Every (fold, configuration) pair is an
+ *        independent job, which is run in parallel on a thread pool.
+ *
+ *        The folds are index views into one shared dataset, i.e. the data is
+ *        never copied, each job only holds the indexes of its training sets.
+ *
+ *        Host only (requires threads), not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+#include <host/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Struct holding one hyperparameter configuration of LinReg::Train.
+ ********************************************************************************/
+struct TrainConfig {
+    size_t num_epochs;
+    double learning_rate;
+};
+
+/********************************************************************************
+ * @brief Struct holding the cross-validation result of one configuration.
+ *
+ * @param config
+ *        The evaluated configuration.
+ * @param mean_error
+ *        The mean squared validation error averaged over all folds. Diverged
+ *        trainings give an infinite error.
+ * @param train_ms
+ *        The total time spent training and validating the configuration,
+ *        summed over all folds.
+ ********************************************************************************/
+struct ConfigResult {
+    TrainConfig config;
+    double mean_error;
+    double train_ms;
+};
+
+/********************************************************************************
+ * @brief Struct holding the result of a model selection.
+ *
+ * @param best
+ *        The configuration with the lowest mean validation error.
+ * @param results
+ *        The result of each configuration, in the specified order.
+ * @param wall_ms
+ *        The wall-clock time of the whole selection.
+ * @param job_ms
+ *        The summed time of all jobs, i.e. the time needed on a single thread.
+ * @param num_threads
+ *        The number of worker threads used.
+ ********************************************************************************/
+struct SelectionResult {
+    ConfigResult best;
+    std::vector<ConfigResult> results;
+    double wall_ms;
+    double job_ms;
+    size_t num_threads;
+};
+
+/********************************************************************************
+ * @brief Creates a grid of configurations, i.e. every combination of the
+ *        specified epochs and learning rates.
+ ********************************************************************************/
+inline std::vector<TrainConfig> GridSearch(const std::vector<size_t>& epochs,
+                                           const std::vector<double>& learning_rates) {
+    std::vector<TrainConfig> configs{};
+    for (const auto& num_epochs : epochs) {
+        for (const auto& learning_rate : learning_rates) {
+            configs.push_back({num_epochs, learning_rate});
+        }
+    }
+    return configs;
+}
+
+/********************************************************************************
+ * @brief Creates specified number of random configurations, where the number
+ *        of epochs is drawn uniformly and the learning rate log-uniformly from
+ *        the specified (inclusive) ranges.
+ ********************************************************************************/
+inline std::vector<TrainConfig> RandomSearch(const size_t num_configs,
+                                             const size_t min_epochs, const size_t max_epochs,
+                                             const double min_learning_rate,
+                                             const double max_learning_rate,
+                                             const uint32_t seed = 0) {
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<size_t> epochs{min_epochs, max_epochs};
+    std::uniform_real_distribution<double> exponent{std::log(min_learning_rate),
+                                                    std::log(max_learning_rate)};
+    std::vector<TrainConfig> configs{};
+    for (size_t i{}; i < num_configs; ++i) {
+        configs.push_back({epochs(generator), std::exp(exponent(generator))});
+    }
+    return configs;
+}
+
+/********************************************************************************
+ * @brief Selects the best configuration for LinReg::Train via k-fold
+ *        cross-validation. The sets are shuffled once and split into num_folds
+ *        folds. For each (fold, configuration) pair, a new model is trained on
+ *        all other folds and its mean squared error on the fold is calculated.
+ *
+ * @param train_in
+ *        Reference to vector containing input data (x).
+ * @param train_out
+ *        Reference to vector containing reference data (y_ref).
+ * @param configs
+ *        Reference to vector holding the configurations to evaluate.
+ * @param num_folds
+ *        The number of folds (default = 5).
+ * @param num_threads
+ *        The number of worker threads (default = 0, one per hardware thread).
+ * @param seed
+ *        Seed for the split into folds and the training order of each job, so
+ *        the result is reproducible (default = 0).
+ * @return
+ *        The best configuration, the result of each configuration and timings.
+ *        No configuration is evaluated if less than two folds are specified or
+ *        there are fewer sets than folds.
+ ********************************************************************************/
+inline SelectionResult SelectModel(const container::Vector<double>& train_in,
+                                   const container::Vector<double>& train_out,
+                                   const std::vector<TrainConfig>& configs,
+                                   const size_t num_folds = 5, const size_t num_threads = 0,
+                                   const uint32_t seed = 0) {
+    using Clock = std::chrono::steady_clock;
+    const auto start{Clock::now()};
+    const auto num_sets{std::min(train_in.Size(), train_out.Size())};
+    if (num_folds < 2 || num_sets < num_folds) return {{{0, 0.0}, INFINITY, 0.0}, {}, 0.0, 0.0, 0};
+
+    std::vector<size_t> indexes(num_sets);
+    for (size_t i{}; i < num_sets; ++i) {
+        indexes[i] = i;
+    }
+    std::shuffle(indexes.begin(), indexes.end(), std::mt19937{seed});
+
+    const auto fold_begin{[&](const size_t fold) { return fold * num_sets / num_folds; }};
+    std::vector<double> errors(num_folds * configs.size());
+    std::vector<double> job_ms(num_folds * configs.size());
+    size_t threads_used{};
+    {
+        ThreadPool pool{num_threads};
+        threads_used = pool.NumThreads();
+        for (size_t c{}; c < configs.size(); ++c) {
+            for (size_t f{}; f < num_folds; ++f) {
+                pool.Submit([&, c, f] {
+                    const auto job_start{Clock::now()};
+                    const auto first{indexes.data() + fold_begin(f)};
+                    const auto last{indexes.data() + fold_begin(f + 1)};
+                    std::vector<size_t> order{indexes.data(), first};
+                    order.insert(order.end(), last, indexes.data() + num_sets);
+
+                    LinReg model{};
+                    model.SetRandomSeed(seed + static_cast<uint32_t>(c * num_folds + f) + 1);
+                    model.Train(train_in.Data(), train_out.Data(), order.data(), order.size(),
+                                configs[c].num_epochs, configs[c].learning_rate);
+                    double sum{};
+                    for (auto i{first}; i != last; ++i) {
+                        const auto error{train_out[*i] - model.Predict(train_in[*i])};
+                        sum += error * error;
+                    }
+                    const auto error{last > first ? sum / (last - first) : 0.0};
+                    errors[c * num_folds + f] = std::isfinite(error) ? error : INFINITY;
+                    job_ms[c * num_folds + f] = std::chrono::duration<double, std::milli>(
+                        Clock::now() - job_start).count();
+                });
+            }
+        }
+    }
+
+    SelectionResult result{{{0, 0.0}, INFINITY, 0.0}, {}, 0.0, 0.0, threads_used};
+    for (size_t c{}; c < configs.size(); ++c) {
+        ConfigResult config_result{configs[c], 0.0, 0.0};
+        for (size_t f{}; f < num_folds; ++f) {
+            config_result.mean_error += errors[c * num_folds + f] / num_folds;
+            config_result.train_ms += job_ms[c * num_folds + f];
+        }
+        result.job_ms += config_result.train_ms;
+        result.results.push_back(config_result);
+        if (config_result.mean_error < result.best.mean_error) result.best = config_result;
+    }
+    result.wall_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return result;
+}
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,110 @@
+/********************************************************************************
+ * @brief Host benchmark comparing one LinReg per output against a single
+ *        MultiOutputLinReg for three quantities derived from the same input,
+ *        for SGD training, closed-form fitting and prediction.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/multi_output_benchmark.cpp lin_reg.cpp \
+ *                multi_output_lin_reg.cpp training_telemetry.cpp -o multi_output_benchmark
+ ********************************************************************************/
+#include <lin_reg.hpp>
+#include <multi_output_lin_reg.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSets{100000};
+constexpr size_t kNumOutputs{3};
+constexpr size_t kNumEpochs{20};
+constexpr size_t kNumPredictions{10000000};
+constexpr double kLearningRate{0.01};
+constexpr double kWeights[kNumOutputs]{20.0, -1.5, 0.2};
+constexpr double kBiases[kNumOutputs]{-50.0, 3.0, 0.05};
+
+/********************************************************************************
+ * @brief Returns the time in ms spent running specified function.
+ ********************************************************************************/
+template <typename Function>
+double Time(Function function) {
+    const auto start{std::chrono::steady_clock::now()};
+    function();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{17};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, 0.05};
+    Vector<double> train_in{kNumSets}, train_out{kNumSets * kNumOutputs};
+    Vector<double> separate_out[kNumOutputs]{};
+    for (auto& out : separate_out) {
+        out.Resize(kNumSets);
+    }
+    for (size_t i{}; i < kNumSets; ++i) {
+        train_in[i] = input(generator);
+        for (size_t o{}; o < kNumOutputs; ++o) {
+            train_out[i * kNumOutputs + o] = separate_out[o][i] =
+                kWeights[o] * train_in[i] + kBiases[o] + noise(generator);
+        }
+    }
+
+    LinReg separate[kNumOutputs]{};
+    for (size_t o{}; o < kNumOutputs; ++o) {
+        separate[o].LoadTrainingData(train_in, separate_out[o]);
+    }
+    MultiOutputLinReg shared{};
+    shared.LoadTrainingData(train_in, train_out, kNumOutputs);
+
+    const auto separate_train{Time([&] {
+        for (auto& model : separate) model.Train(kNumEpochs, kLearningRate);
+    })};
+    const auto shared_train{Time([&] { shared.Train(kNumEpochs, kLearningRate); })};
+    std::printf("Train %zu epochs: %zu x LinReg %.1f ms, MultiOutputLinReg %.1f ms (%.2fx)\n",
+                kNumEpochs, kNumOutputs, separate_train, shared_train,
+                separate_train / shared_train);
+
+    const auto separate_fit{Time([&] {
+        for (auto& model : separate) model.Fit();
+    })};
+    const auto shared_fit{Time([&] { shared.Fit(); })};
+    std::printf("Fit:              %zu x LinReg %.2f ms, MultiOutputLinReg %.2f ms (%.2fx)\n",
+                kNumOutputs, separate_fit, shared_fit, separate_fit / shared_fit);
+
+    double outputs[kNumOutputs]{}, checksum{};
+    const auto separate_predict{Time([&] {
+        for (size_t i{}; i < kNumPredictions; ++i) {
+            const auto x{i * 5.0 / kNumPredictions};
+            for (size_t o{}; o < kNumOutputs; ++o) checksum += separate[o].Predict(x);
+        }
+    })};
+    const auto shared_predict{Time([&] {
+        for (size_t i{}; i < kNumPredictions; ++i) {
+            shared.Predict(i * 5.0 / kNumPredictions, outputs);
+            for (size_t o{}; o < kNumOutputs; ++o) checksum += outputs[o];
+        }
+    })};
+    std::printf("Predict %zu sets: %zu x LinReg %.1f ms, MultiOutputLinReg %.1f ms (%.2fx)\n",
+                kNumPredictions, kNumOutputs, separate_predict, shared_predict,
+                separate_predict / shared_predict);
+
+    double errors[kNumOutputs]{};
+    shared.MeanSquaredErrors(train_in, train_out, errors);
+    for (size_t o{}; o < kNumOutputs; ++o) {
+        const auto parameters{separate[o].GetParameters()};
+        std::printf("Output %zu: LinReg k=%.5f m=%.5f, MultiOutputLinReg k=%.5f m=%.5f "
+                    "MSE=%.6f\n", o, parameters.weight, parameters.bias, shared.Weights()[o],
+                    shared.Biases()[o], errors[o]);
+    }
+    std::printf("(checksum %g)\n", checksum);
+    return 0;
+}
\ No newline at end of file
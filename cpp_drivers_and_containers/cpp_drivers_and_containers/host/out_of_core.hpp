@@ -0,0 +1,306 @@
+/********************************************************************************
+ * @brief Host-side out-of-core training of the LinReg class for datasets
+ *        larger than RAM. The dataset is stored in a binary file of (x, y)
+ *        pairs of doubles and trained chunk by chunk. A prefetch thread reads
+ *        the next chunk into a second buffer while SGD runs on the current
+ *        one, so the disk and the CPU work at the same time.
+ *
+ *        The file is either read with pread (with sequential read-ahead hints
+ *        via posix_fadvise) or memory-mapped (with madvise hints, where the
+ *        next chunk is requested with MADV_WILLNEED). In both cases the
+ *        prefetch thread also splits the pairs into the input and reference
+ *        arrays used by LinReg::Train. When the file is only passed once, each
+ *        consumed chunk is dropped from the page cache, so a huge dataset
+ *        doesn't evict everything else.
+ *
+ *        Each chunk is trained as one LinReg epoch, where the sets of the chunk
+ *        are shuffled, so the epoch counter of the model counts chunks.
+ *
+ *        Host only (requires POSIX and threads), not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Enumeration class for selecting how the dataset file is read.
+ *
+ * @param kPread
+ *        Read each chunk with pread.
+ * @param kMmap
+ *        Map the whole file into memory and copy each chunk from the mapping.
+ ********************************************************************************/
+enum class IoMode { kPread, kMmap };
+
+/********************************************************************************
+ * @brief Struct holding statistics of an out-of-core training.
+ *
+ * @param num_chunks
+ *        The number of trained chunks (over all epochs).
+ * @param num_sets
+ *        The number of sets in the dataset.
+ * @param wall_ms
+ *        The total time of the training.
+ * @param io_ms
+ *        The time spent reading and splitting chunks.
+ * @param compute_ms
+ *        The time spent training chunks.
+ * @param stall_ms
+ *        The time the training waited for the next chunk.
+ * @param overlap
+ *        The share of the I/O time hidden behind the training, i.e.
+ *        1 - stall / io, where 1 means perfect overlap and 0 means none.
+ * @param read_errors
+ *        The number of chunks that couldn't be read completely, of which only
+ *        the complete sets read were trained (0 if all reads succeeded).
+ ********************************************************************************/
+struct OutOfCoreStats {
+    size_t num_chunks;
+    size_t num_sets;
+    double wall_ms;
+    double io_ms;
+    double compute_ms;
+    double stall_ms;
+    double overlap;
+    size_t read_errors;
+};
+
+/********************************************************************************
+ * @brief Writes specified dataset to a file of (x, y) pairs of doubles.
+ *
+ * @param path
+ *        The path of the file.
+ * @param input
+ *        Pointer to array containing input data (x).
+ * @param reference
+ *        Pointer to array containing reference data (y_ref).
+ * @param num_sets
+ *        The number of sets to write.
+ * @return
+ *        True if the file was written, else false.
+ ********************************************************************************/
+inline bool WriteDataset(const std::string& path, const double* input, const double* reference,
+                         const size_t num_sets) {
+    auto file{std::fopen(path.c_str(), "wb")};
+    if (file == nullptr) return false;
+    bool written{true};
+    for (size_t i{}; i < num_sets && written; ++i) {
+        const double pair[]{input[i], reference[i]};
+        written = std::fwrite(pair, sizeof(pair), 1, file) == 1;
+    }
+    return std::fclose(file) == 0 && written;
+}
+
+/********************************************************************************
+ * @brief Trains specified model on a dataset file chunk by chunk.
+ *
+ * @param model
+ *        Reference to the model to train.
+ * @param path
+ *        The path of the dataset file, see WriteDataset.
+ * @param chunk_sets
+ *        The number of sets per chunk.
+ * @param num_epochs
+ *        The number of passes over the whole dataset.
+ * @param learning_rate
+ *        The learning rate.
+ * @param mode
+ *        How the file is read (default = pread).
+ * @param prefetch
+ *        True to read the next chunk in a prefetch thread while training the
+ *        current one, false to read and train serially (default = true).
+ * @return
+ *        The statistics of the training (num_sets = 0 if the file couldn't be
+ *        opened or mapped, read_errors > 0 if a chunk couldn't be read).
+ ********************************************************************************/
+inline OutOfCoreStats TrainOutOfCore(LinReg& model, const std::string& path,
+                                     const size_t chunk_sets, const size_t num_epochs,
+                                     const double learning_rate, const IoMode mode = IoMode::kPread,
+                                     const bool prefetch = true) {
+    using Clock = std::chrono::steady_clock;
+    const auto ms{[](const Clock::time_point start, const Clock::time_point end) {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }};
+    OutOfCoreStats stats{0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0};
+    constexpr size_t kPairSize{2 * sizeof(double)};
+    if (chunk_sets == 0) return stats;
+
+    const auto fd{open(path.c_str(), O_RDONLY)};
+    if (fd < 0) return stats;
+    struct stat info{};
+    if (fstat(fd, &info) != 0) info.st_size = 0;
+    const auto num_sets{static_cast<size_t>(info.st_size) / kPairSize};
+    const auto chunks_per_epoch{(num_sets + chunk_sets - 1) / chunk_sets};
+    const auto total_chunks{chunks_per_epoch * num_epochs};
+    if (num_sets == 0) {
+        close(fd);
+        return stats;
+    }
+
+    const double* mapping{};
+    if (mode == IoMode::kMmap) {
+        auto address{mmap(nullptr, num_sets * kPairSize, PROT_READ, MAP_PRIVATE, fd, 0)};
+        if (address == MAP_FAILED) {
+            close(fd);
+            return stats;
+        }
+        madvise(address, num_sets * kPairSize, MADV_SEQUENTIAL);
+        mapping = static_cast<const double*>(address);
+    } else {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    /********************************************************************************
+     * @brief Buffer holding one chunk, split into input and reference arrays.
+     ********************************************************************************/
+    struct Buffer {
+        std::vector<double> input;
+        std::vector<double> reference;
+        std::vector<size_t> order;
+        size_t num_sets;
+        bool full;
+    };
+    Buffer buffers[2]{};
+    std::vector<double> raw(chunk_sets * 2);
+    for (auto& buffer : buffers) {
+        buffer.input.resize(chunk_sets);
+        buffer.reference.resize(chunk_sets);
+        buffer.order.resize(chunk_sets);
+    }
+
+    /* Reads chunk number n (counted over all epochs) into specified buffer. Only
+       the complete sets actually read are kept if a read fails or comes up short.
+       The loads are made by one thread at a time, so the error count needs no lock. */
+    size_t read_errors{};
+    const auto load{[&](const size_t n, Buffer& buffer) {
+        const auto first{(n % chunks_per_epoch) * chunk_sets};
+        auto count{first + chunk_sets < num_sets ? chunk_sets : num_sets - first};
+        const double* pairs{};
+        if (mode == IoMode::kMmap) {
+            pairs = mapping + first * 2;
+            const auto next{first + count < num_sets ? first + count : 0};
+            const auto next_count{next + chunk_sets < num_sets ? chunk_sets : num_sets - next};
+            const auto page{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+            const auto align{[page](const double* p) {
+                return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(p) & ~(page - 1));
+            }};
+            madvise(align(mapping + next * 2), next_count * kPairSize, MADV_WILLNEED);
+        } else {
+            auto bytes{reinterpret_cast<char*>(raw.data())};
+            size_t done{};
+            while (done < count * kPairSize) {
+                const auto result{pread(fd, bytes + done, count * kPairSize - done,
+                                        static_cast<off_t>(first * kPairSize + done))};
+                if (result <= 0) break;
+                done += static_cast<size_t>(result);
+            }
+            if (done < count * kPairSize) {
+                count = done / kPairSize;
+                read_errors++;
+            }
+            pairs = raw.data();
+        }
+        for (size_t i{}; i < count; ++i) {
+            buffer.input[i] = pairs[2 * i];
+            buffer.reference[i] = pairs[2 * i + 1];
+            buffer.order[i] = i;
+        }
+        if (num_epochs == 1) {
+            if (mode == IoMode::kMmap) {
+                const auto page{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+                const auto begin{reinterpret_cast<uintptr_t>(pairs) & ~(page - 1)};
+                madvise(reinterpret_cast<void*>(begin),
+                        reinterpret_cast<uintptr_t>(pairs + count * 2) - begin, MADV_DONTNEED);
+            }
+            posix_fadvise(fd, static_cast<off_t>(first * kPairSize),
+                          static_cast<off_t>(count * kPairSize), POSIX_FADV_DONTNEED);
+        }
+        buffer.num_sets = count;
+    }};
+
+    const auto start{Clock::now()};
+    if (!prefetch) {
+        for (size_t n{}; n < total_chunks; ++n) {
+            const auto io_start{Clock::now()};
+            load(n, buffers[0]);
+            const auto compute_start{Clock::now()};
+            model.Train(buffers[0].input.data(), buffers[0].reference.data(), buffers[0].order.data(),
+                        buffers[0].num_sets, 1, learning_rate);
+            const auto compute_end{Clock::now()};
+            stats.io_ms += ms(io_start, compute_start);
+            stats.compute_ms += ms(compute_start, compute_end);
+        }
+        stats.stall_ms = stats.io_ms;
+    } else {
+        std::mutex mutex{};
+        std::condition_variable changed{};
+        double io_ms{};
+        std::thread prefetcher{[&] {
+            for (size_t n{}; n < total_chunks; ++n) {
+                auto& buffer{buffers[n % 2]};
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    changed.wait(lock, [&] { return !buffer.full; });
+                }
+                const auto io_start{Clock::now()};
+                load(n, buffer);
+                io_ms += ms(io_start, Clock::now());
+                {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    buffer.full = true;
+                }
+                changed.notify_all();
+            }
+        }};
+        for (size_t n{}; n < total_chunks; ++n) {
+            auto& buffer{buffers[n % 2]};
+            const auto wait_start{Clock::now()};
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                changed.wait(lock, [&] { return buffer.full; });
+            }
+            const auto compute_start{Clock::now()};
+            model.Train(buffer.input.data(), buffer.reference.data(), buffer.order.data(),
+                        buffer.num_sets, 1, learning_rate);
+            stats.stall_ms += ms(wait_start, compute_start);
+            stats.compute_ms += ms(compute_start, Clock::now());
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                buffer.full = false;
+            }
+            changed.notify_all();
+        }
+        prefetcher.join();
+        stats.io_ms = io_ms;
+    }
+    stats.wall_ms = ms(start, Clock::now());
+
+    if (mapping != nullptr) munmap(const_cast<double*>(mapping), num_sets * kPairSize);
+    close(fd);
+    stats.num_chunks = total_chunks;
+    stats.num_sets = num_sets;
+    stats.read_errors = read_errors;
+    stats.overlap = stats.io_ms > 0 ? 1.0 - stats.stall_ms / stats.io_ms : 0.0;
+    if (stats.overlap < 0.0) stats.overlap = 0.0;
+    return stats;
+}
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,80 @@
+/********************************************************************************
+ * @brief Host benchmark of out-of-core LinReg training, comparing serial
+ *        read-then-train against double-buffered prefetching with both pread
+ *        and mmap. The file is evicted from the page cache before each run
+ *        (posix_fadvise with POSIX_FADV_DONTNEED), so the reads hit the disk
+ *        as they would for a dataset larger than RAM.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -pthread -I. host/out_of_core_benchmark.cpp \
+ *                lin_reg.cpp training_telemetry.cpp -o out_of_core_benchmark
+ *
+ *        An optional argument sets the number of sets (default = 8 000 000,
+ *        i.e. a 128 MB file).
+ ********************************************************************************/
+#include <host/out_of_core.hpp>
+
+#include <cstdlib>
+#include <random>
+
+using namespace yrgo;
+
+namespace {
+
+constexpr char kPath[]{"out_of_core_dataset.bin"};
+constexpr size_t kChunkSets{65536};
+constexpr double kLearningRate{0.0005};
+
+/********************************************************************************
+ * @brief Evicts the dataset file from the page cache.
+ ********************************************************************************/
+void Evict(void) {
+    const auto fd{open(kPath, O_RDONLY)};
+    if (fd < 0) return;
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+}
+
+/********************************************************************************
+ * @brief Trains a new model with specified mode and prints the statistics.
+ ********************************************************************************/
+void Run(const char* name, const host::IoMode mode, const bool prefetch) {
+    Evict();
+    LinReg model{};
+    model.SetRandomSeed(1);
+    const auto stats{host::TrainOutOfCore(model, kPath, kChunkSets, 1, kLearningRate, mode, prefetch)};
+    const auto parameters{model.GetParameters()};
+    std::printf("%-16s wall %7.1f ms, I/O %7.1f ms, compute %7.1f ms, stall %7.1f ms, "
+                "overlap %3.0f %%, k=%.3f m=%.3f\n", name, stats.wall_ms, stats.io_ms,
+                stats.compute_ms, stats.stall_ms, stats.overlap * 100, parameters.weight,
+                parameters.bias);
+    if (stats.read_errors > 0) {
+        std::printf("%-16s %zu chunks couldn't be read completely!\n", name, stats.read_errors);
+    }
+}
+
+} /* namespace */
+
+int main(int argc, char** argv) {
+    const size_t num_sets{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 8000000};
+    std::mt19937 generator{9};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, 0.1};
+    std::vector<double> x(num_sets), y(num_sets);
+    for (size_t i{}; i < num_sets; ++i) {
+        x[i] = input(generator);
+        y[i] = 20.0 * x[i] - 50.0 + noise(generator);
+    }
+    if (!host::WriteDataset(kPath, x.data(), y.data(), num_sets)) return 1;
+    std::printf("%zu sets (%.0f MB), chunks of %zu sets, %u hardware threads\n", num_sets,
+                num_sets * 16 / 1e6, kChunkSets, std::thread::hardware_concurrency());
+
+    Run("pread, serial", host::IoMode::kPread, false);
+    Run("pread, prefetch", host::IoMode::kPread, true);
+    Run("mmap, serial", host::IoMode::kMmap, false);
+    Run("mmap, prefetch", host::IoMode::kMmap, true);
+    std::remove(kPath);
+    return 0;
+}
\ No newline at end of file
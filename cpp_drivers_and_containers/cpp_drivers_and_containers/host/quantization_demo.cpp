@@ -0,0 +1,111 @@
+/********************************************************************************
+ * @brief Host program checking the accuracy of QuantizedLinReg against the
+ *        floating-point MultiLinReg it was quantized from, for an 8-channel
+ *        model on 10-bit ADC codes, with int8 and int16 weights. The time per
+ *        prediction is measured too, but only on the host; the cycle counts on
+ *        the ATmega328P have to be measured on the board.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/quantization_demo.cpp multi_lin_reg.cpp \
+ *                -o quantization_demo
+ ********************************************************************************/
+#include <quantized_lin_reg.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumFeatures{8};
+constexpr size_t kNumSets{5000};
+constexpr size_t kNumTests{100000};
+constexpr int16_t kMaxCode{1023};
+constexpr double kScales[kNumFeatures]{5.0 / 1023, 5.0 / 1023, 3.3 / 1023, 3.3 / 1023,
+                                       1.1 / 1023, 1.1 / 1023, 5.0 / 1023, 2.56 / 1023};
+constexpr double kOffsets[kNumFeatures]{0.0, 0.0, 0.1, 0.1, 0.0, -0.05, 0.0, 0.0};
+constexpr double kWeights[kNumFeatures]{20.0, -8.0, 3.5, 0.7, 45.0, -12.0, 1.0, 6.0};
+constexpr double kBias{-50.0};
+
+/********************************************************************************
+ * @brief Converts specified codes to input values.
+ ********************************************************************************/
+void ToInputs(const int16_t* codes, Vector<double>& inputs) {
+    for (size_t j{}; j < kNumFeatures; ++j) {
+        inputs[j] = kScales[j] * codes[j] + kOffsets[j];
+    }
+}
+
+/********************************************************************************
+ * @brief Compares specified quantized model against the float model on random
+ *        codes and prints the errors and timings.
+ ********************************************************************************/
+template <typename T>
+void Compare(const char* name, const MultiLinReg& model, const QuantizedLinReg<T>& quantized,
+             const Vector<int16_t>& codes) {
+    Vector<double> inputs{kNumFeatures};
+    double max_error{}, sum_squares{}, float_sum{}, int_sum{};
+    for (size_t i{}; i < kNumTests; ++i) {
+        ToInputs(codes.Data() + i * kNumFeatures, inputs);
+        const auto prediction{quantized.Predict(codes.Data() + i * kNumFeatures)};
+        const auto error{prediction - model.Predict(inputs)};
+        sum_squares += error * error;
+        if (std::fabs(error) > max_error) max_error = std::fabs(error);
+    }
+
+    auto start{std::chrono::steady_clock::now()};
+    for (size_t i{}; i < kNumTests; ++i) {
+        ToInputs(codes.Data() + i * kNumFeatures, inputs);
+        float_sum += model.Predict(inputs);
+    }
+    const std::chrono::duration<double, std::nano> float_ns{std::chrono::steady_clock::now() -
+                                                            start};
+    start = std::chrono::steady_clock::now();
+    for (size_t i{}; i < kNumTests; ++i) {
+        int_sum += quantized.Predict(codes.Data() + i * kNumFeatures);
+    }
+    const std::chrono::duration<double, std::nano> int_ns{std::chrono::steady_clock::now() - start};
+
+    std::printf("%s: output scale %.3g, bound %.4f, max error %.4f, RMS error %.5f, "
+                "%.1f ns vs %.1f ns float (sums %.1f/%.1f)\n", name, quantized.OutputScale(),
+                quantized.OutputScale() / 2 * kNumFeatures * kMaxCode, max_error,
+                std::sqrt(sum_squares / kNumTests), int_ns.count() / kNumTests,
+                float_ns.count() / kNumTests, int_sum / kNumTests, float_sum / kNumTests);
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{19};
+    std::uniform_int_distribution<int> code{0, kMaxCode};
+    std::normal_distribution<double> noise{0.0, 0.05};
+    Vector<double> train_in{kNumSets * kNumFeatures}, train_out{kNumSets};
+    for (size_t i{}; i < kNumSets; ++i) {
+        train_out[i] = kBias + noise(generator);
+        for (size_t j{}; j < kNumFeatures; ++j) {
+            const auto x{kScales[j] * code(generator) + kOffsets[j]};
+            train_in[j * kNumSets + i] = x;
+            train_out[i] += kWeights[j] * x;
+        }
+    }
+    MultiLinReg model{};
+    model.LoadTrainingData(train_in, kNumFeatures, train_out);
+    model.Fit(MultiLinReg::Penalty::kRidge, 0.0);
+
+    Vector<int16_t> codes{kNumTests * kNumFeatures};
+    for (auto& c : codes) {
+        c = static_cast<int16_t>(code(generator));
+    }
+    QuantizedLinReg<int8_t> quantized8{};
+    QuantizedLinReg<int16_t> quantized16{};
+    quantized8.Quantize(model, kScales, kOffsets);
+    quantized16.Quantize(model, kScales, kOffsets);
+    Compare("int8 ", model, quantized8, codes);
+    Compare("int16", model, quantized16, codes);
+    return 0;
+}
\ No newline at end of file
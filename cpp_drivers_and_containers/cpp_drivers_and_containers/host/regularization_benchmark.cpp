@@ -0,0 +1,94 @@
+/********************************************************************************
+ * @brief Host benchmark comparing stochastic gradient descent with ridge and
+ *        lasso coordinate descent for multiple linear regression on strongly
+ *        correlated features (e.g. several ADC channels measuring the same
+ *        quantity). The time needed to reach a given validation error is
+ *        measured for each solver.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/regularization_benchmark.cpp \
+ *                multi_lin_reg.cpp -o regularization_benchmark
+ ********************************************************************************/
+#include <multi_lin_reg.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumFeatures{8};
+constexpr size_t kNumTrainSets{2000};
+constexpr size_t kNumValidationSets{500};
+constexpr double kNoise{0.5};
+
+/********************************************************************************
+ * @brief Generates column-major data where every feature is the same signal
+ *        plus a small amount of channel noise, which makes the features highly
+ *        correlated.
+ ********************************************************************************/
+void GenerateData(std::mt19937& generator, const size_t num_sets,
+                  Vector<double>& input, Vector<double>& output) {
+    std::normal_distribution<double> signal{2.5, 1.0}, channel{0.0, 0.05}, noise{0.0, kNoise};
+    input.Resize(num_sets * kNumFeatures);
+    output.Resize(num_sets);
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto x{signal(generator)};
+        output[i] = noise(generator) - 50.0;
+        for (size_t j{}; j < kNumFeatures; ++j) {
+            input[j * num_sets + i] = x + channel(generator);
+            output[i] += 100.0 / kNumFeatures * input[j * num_sets + i];
+        }
+    }
+}
+
+double ElapsedMs(const std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{42};
+    Vector<double> train_in{}, train_out{}, validation_in{}, validation_out{};
+    GenerateData(generator, kNumTrainSets, train_in, train_out);
+    GenerateData(generator, kNumValidationSets, validation_in, validation_out);
+    const auto target{kNoise * kNoise * 1.01};
+    std::printf("Target validation MSE: %.4f\n", target);
+
+    MultiLinReg sgd{};
+    sgd.LoadTrainingData(train_in, kNumFeatures, train_out);
+    auto start{std::chrono::steady_clock::now()};
+    size_t epochs{};
+    auto error{sgd.MeanSquaredError(validation_in, validation_out)};
+    while (error > target && epochs < 10000) {
+        sgd.Train(1, 0.002);
+        error = sgd.MeanSquaredError(validation_in, validation_out);
+        ++epochs;
+    }
+    std::printf("SGD:   %6zu epochs, %9.2f ms, validation MSE %.4f\n", epochs, ElapsedMs(start), error);
+
+    const MultiLinReg::Penalty penalties[]{MultiLinReg::Penalty::kRidge, MultiLinReg::Penalty::kLasso};
+    const char* names[]{"Ridge", "Lasso"};
+    for (size_t p{}; p < 2; ++p) {
+        MultiLinReg model{};
+        model.LoadTrainingData(train_in, kNumFeatures, train_out);
+        start = std::chrono::steady_clock::now();
+        auto lambda{1.0};
+        size_t passes{}, fits{};
+        error = model.MeanSquaredError(validation_in, validation_out);
+        while (error > target && fits < 20) {
+            passes += model.Fit(penalties[p], lambda, 1000, 1e-4);
+            error = model.MeanSquaredError(validation_in, validation_out);
+            lambda /= 2;
+            ++fits;
+        }
+        std::printf("%s: %6zu passes (%zu warm-started lambdas), %9.2f ms, validation MSE %.4f\n",
+                    names[p], passes, fits, ElapsedMs(start), error);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+/********************************************************************************
+ * @brief Host program comparing sample weights with duplicated training sets.
+ *        A noisy sensor provides many calibration points, while a reference
+ *        thermometer provides a few accurate ones, which should count kCopies
+ *        times as much. The model is fitted and trained unweighted, with the
+ *        reference points weighted via LinReg sample weights and with the
+ *        reference points stored kCopies times, and the parameter errors, the
+ *        number of stored sets and the training time are compared.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/sample_weights_demo.cpp lin_reg.cpp \
+ *                training_telemetry.cpp -o sample_weights_demo
+ ********************************************************************************/
+#include <lin_reg.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSensorSets{400};
+constexpr size_t kNumReferenceSets{10};
+constexpr size_t kCopies{50};
+constexpr size_t kNumEpochs{500};
+constexpr double kLearningRate{0.0005};
+constexpr double kWeight{20.0};
+constexpr double kBias{-50.0};
+
+/********************************************************************************
+ * @brief Fits and trains specified model, then prints the parameter errors
+ *        against the true line and the training time per epoch.
+ ********************************************************************************/
+void Report(const char* name, LinReg& model, const size_t num_sets) {
+    model.Fit();
+    const auto fitted{model.GetParameters()};
+    model.SetParameters({0.0, 0.0});
+    model.SetRandomSeed(7);
+    const auto start{std::chrono::steady_clock::now()};
+    model.Train(kNumEpochs, kLearningRate);
+    const std::chrono::duration<double, std::micro> elapsed{std::chrono::steady_clock::now() -
+                                                            start};
+    const auto trained{model.GetParameters()};
+    std::printf("%-11s %4zu sets: fit k=%8.4f m=%9.4f, SGD k=%8.4f m=%9.4f, "
+                "%6.1f us per epoch\n", name, num_sets, fitted.weight - kWeight,
+                fitted.bias - kBias, trained.weight - kWeight, trained.bias - kBias,
+                elapsed.count() / kNumEpochs);
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{5};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> sensor_noise{1.5, 2.0};
+    std::normal_distribution<double> reference_noise{0.0, 0.05};
+
+    Vector<double> train_in{}, train_out{}, weights{};
+    Vector<double> copied_in{}, copied_out{};
+    for (size_t i{}; i < kNumSensorSets; ++i) {
+        const auto x{input(generator)};
+        const auto y{kWeight * x + kBias + sensor_noise(generator)};
+        train_in.PushBack(x);
+        train_out.PushBack(y);
+        weights.PushBack(1.0);
+        copied_in.PushBack(x);
+        copied_out.PushBack(y);
+    }
+    for (size_t i{}; i < kNumReferenceSets; ++i) {
+        const auto x{input(generator)};
+        const auto y{kWeight * x + kBias + reference_noise(generator)};
+        train_in.PushBack(x);
+        train_out.PushBack(y);
+        weights.PushBack(static_cast<double>(kCopies));
+        for (size_t j{}; j < kCopies; ++j) {
+            copied_in.PushBack(x);
+            copied_out.PushBack(y);
+        }
+    }
+
+    std::printf("Parameter errors against k=%.1f m=%.1f (biased sensor, %zu reference "
+                "points counting %zux):\n", kWeight, kBias, kNumReferenceSets, kCopies);
+    LinReg unweighted{train_in, train_out};
+    Report("Unweighted", unweighted, train_in.Size());
+    LinReg weighted{train_in, train_out, weights};
+    Report("Weighted", weighted, train_in.Size());
+    LinReg duplicated{copied_in, copied_out};
+    Report("Duplicated", duplicated, copied_in.Size());
+    return 0;
+}
\ No newline at end of file
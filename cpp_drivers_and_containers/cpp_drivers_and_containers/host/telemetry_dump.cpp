@@ -0,0 +1,82 @@
+/********************************************************************************
+ * @brief Host program training LinReg with telemetry attached and dumping the
+ *        per-epoch loss, parameter deltas and elapsed microseconds as CSV and
+ *        JSON files, e.g. for plotting the convergence when tuning the number
+ *        of epochs and the learning rate. The training time with and without
+ *        telemetry is printed as well.
+ *
+ *        Build and run on the host from the project directory:
+ *
+ *            g++ -O2 -std=c++17 -I. host/telemetry_dump.cpp lin_reg.cpp \
+ *                training_telemetry.cpp -o telemetry_dump
+ ********************************************************************************/
+#include <lin_reg.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace yrgo;
+using namespace yrgo::container;
+
+namespace {
+
+constexpr size_t kNumSets{10000};
+constexpr size_t kNumEpochs{500};
+constexpr double kLearningRate{0.001};
+FILE* output{};
+
+/********************************************************************************
+ * @brief Provides the elapsed microseconds since the program was started.
+ ********************************************************************************/
+uint32_t Microseconds(void) {
+    static const auto start{std::chrono::steady_clock::now()};
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+/********************************************************************************
+ * @brief Trains a new model kNumEpochs epochs and returns the elapsed time.
+ ********************************************************************************/
+double TrainMs(const Vector<double>& x, const Vector<double>& y, TrainingTelemetry* telemetry) {
+    LinReg model{x, y};
+    model.SetRandomSeed(1);
+    model.SetTelemetry(telemetry);
+    const auto start{std::chrono::steady_clock::now()};
+    model.Train(kNumEpochs, kLearningRate);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} /* namespace */
+
+int main(void) {
+    std::mt19937 generator{11};
+    std::uniform_real_distribution<double> input{0.0, 5.0};
+    std::normal_distribution<double> noise{0.0, 0.1};
+    Vector<double> x{kNumSets}, y{kNumSets};
+    for (size_t i{}; i < kNumSets; ++i) {
+        x[i] = input(generator);
+        y[i] = 20.0 * x[i] - 50.0 + noise(generator);
+    }
+
+    TrainingTelemetry sparse{64, 50, Microseconds};
+    TrainingTelemetry every{kNumEpochs, 1, Microseconds};
+    std::printf("Without telemetry:             %.1f ms\n", TrainMs(x, y, nullptr));
+    std::printf("Telemetry every 50th epoch:    %.1f ms\n", TrainMs(x, y, &sparse));
+    std::printf("Telemetry every epoch:         %.1f ms\n", TrainMs(x, y, &every));
+
+    const auto write{[](const char* s) { std::fputs(s, output); }};
+    output = std::fopen("telemetry.csv", "w");
+    if (output == nullptr) return 1;
+    every.WriteCsv(write);
+    std::fclose(output);
+    output = std::fopen("telemetry.json", "w");
+    if (output == nullptr) return 1;
+    every.WriteJson(write);
+    std::fclose(output);
+    std::printf("Wrote %zu records to telemetry.csv and telemetry.json\n", every.NumRecords());
+
+    output = stdout;
+    sparse.WriteCsv(write);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+/********************************************************************************
+ * @brief Fixed-size thread pool for the host-side tools.
+ *
+ *        Host only (requires threads), not part of the AVR project.
+ ********************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace yrgo {
+namespace host {
+
+/********************************************************************************
+ * @brief Class implementing a fixed-size thread pool, where queued jobs are run
+ *        by the first available worker thread.
+ ********************************************************************************/
+class ThreadPool {
+  public:
+
+    /********************************************************************************
+     * @brief Creates thread pool with specified number of worker threads.
+     *
+     * @param num_threads
+     *        The number of worker threads (0 = one per hardware thread).
+     ********************************************************************************/
+    explicit ThreadPool(size_t num_threads = 0) {
+        if (num_threads == 0) num_threads = std::max(1U, std::thread::hardware_concurrency());
+        for (size_t i{}; i < num_threads; ++i) {
+            workers_.emplace_back([this] { Run(); });
+        }
+    }
+
+    /********************************************************************************
+     * @brief Waits for all queued jobs to finish, then stops the worker threads.
+     ********************************************************************************/
+    ~ThreadPool(void) {
+        Wait();
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        job_queued_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /********************************************************************************
+     * @brief Provides the number of worker threads.
+     ********************************************************************************/
+    size_t NumThreads(void) const { return workers_.size(); }
+
+    /********************************************************************************
+     * @brief Queues specified job.
+     *
+     * @param job
+     *        The job to run.
+     ********************************************************************************/
+    void Submit(std::function<void(void)> job) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            jobs_.push(std::move(job));
+            ++num_pending_;
+        }
+        job_queued_.notify_one();
+    }
+
+    /********************************************************************************
+     * @brief Blocks until all queued jobs are finished.
+     ********************************************************************************/
+    void Wait(void) {
+        std::unique_lock<std::mutex> lock{mutex_};
+        jobs_done_.wait(lock, [this] { return num_pending_ == 0; });
+    }
+
+  private:
+    std::vector<std::thread> workers_{};
+    std::queue<std::function<void(void)>> jobs_{};
+    std::mutex mutex_{};
+    std::condition_variable job_queued_{};
+    std::condition_variable jobs_done_{};
+    size_t num_pending_{};
+    bool stop_{};
+
+    /********************************************************************************
+     * @brief Runs queued jobs until the pool is stopped.
+     ********************************************************************************/
+    void Run(void) {
+        while (true) {
+            std::function<void(void)> job{};
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                job_queued_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) return;
+                job = std::move(jobs_.front());
+                jobs_.pop();
+            }
+            job();
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (--num_pending_ == 0) jobs_done_.notify_all();
+            }
+        }
+    }
+};
+
+} /* namespace host */
+} /* namespace yrgo */
\ No newline at end of file
@@ -1,121 +1,521 @@
-/********************************************************************************
- * @brief Implementation details for the LinReg class.
- ********************************************************************************/
-#include <lin_reg.hpp>
-
-namespace yrgo {
-
-/********************************************************************************
- * @note  Implementation details:
- *        1. The specified training data is copied and stored in vectors.
- *        2. If the number of input and reference values don't match, the
- *           superfluous values are deleted by resizing the corresponding vector.
- *        3. The index of each training set is stored in the train order vector.
- *        4. The random generator is initializes to ensure that the randomized
- *           sequence is unique each time the program is run.
- ********************************************************************************/
-void LinReg::LoadTrainingData(const container::Vector<double>& train_in, 
-                              const container::Vector<double>& train_out) {
-    train_in_ = train_in; 
-    train_out_ = train_out;
-    MatchTrainingSets();
-    InitTrainOrderVector();
-    InitRandomGenerator();
-}
-
-/********************************************************************************
- * @note Implementation details:
- *        1. A loop is generated to run num_epochs number of times.
- *        2. The training order is randomized before the training begins.
- *        3. We train the model with all the training sets one by one.
- *        4. We fetch the index of the training set and optimize out model.
- ********************************************************************************/
-void LinReg::Train(const size_t num_epochs, const double learning_rate) {
-    for (size_t i{}; i < num_epochs; ++i) {
-        RandomizeTrainingOrder();
-        for (auto& j : train_order_) { 
-            Optimize(train_in_[j], train_out_[j], learning_rate);
-        }
-    }
-}
-
-/********************************************************************************
- * @note  Implementation details:
- *        1. We iterate through the training order vector.
- *        2. We generate a random index between 0 - train_order.Size() - 1.
- *           For instance, if the training order vector has five elements, we
- *           generate a random number between 0 - 4.
- *        3. We swap the values of index i and r in the vector.
- ********************************************************************************/
-void LinReg::RandomizeTrainingOrder(void) {
-    for (size_t i{}; i < train_order_.Size(); ++i) {
-        const auto r{rand() % train_order_.Size()}; 
-        const auto temp{train_order_[i]};
-        train_order_[i] = train_order_[r];
-        train_order_[r] = temp;
-    }
-}
-
-/********************************************************************************
- * @note  Implementation details:
- *        1. If input != 0, we predict with the input and optimize according
- *           to the error.
- *        2. Else, we set the bias to the y_ref value, since y = m if x = 0.
- *           (y = kx + m = k * 0 + 0 => y = m when k = 0).
- ********************************************************************************/
-void LinReg::Optimize(const double input, const double reference, const double learning_rate) {
-    if (input != 0) {
-        const auto error{reference - Predict(input)}; /* error = y_ref - y_pred */
-        bias_ += error * learning_rate;               /* m = m + error * LR */
-        weight_ += error * learning_rate * input;     /* k = k + error * LR * x */
-    } else {
-        bias_ = reference;                            /* m = y_ref when x = 0 */
-    }
-}
-
-/********************************************************************************
- * @note  Implementation details:
- *        1. If the number of input and reference values don't match, i.e. the
- *           size of the train_in_ and train_out_ vectors don't match, the
- *           superfluous values are removed by resizing the larger vector to the
- *           size of the smaller one.
- ********************************************************************************/
-void LinReg::MatchTrainingSets(void) {
-    if (train_in_.Size() != train_out_.Size()) {
-        const auto num_sets{train_in_.Size() < train_out_.Size() ? 
-                            train_in_.Size() : train_out_.Size()};
-        train_in_.Resize(num_sets);
-        train_out_.Resize(num_sets);
-    }
-}
-
-/********************************************************************************
- * @note  Implementation details:
- *        1. The size of the train order vector is set to the number of stored
- *           training sets.
- *        2. The vector is assigned the index of each stored training set, e.g.
- *           0 - 9 if ten training sets are stored.
- ********************************************************************************/
-void LinReg::InitTrainOrderVector(void) {
-    train_order_.Resize(train_in_.Size());
-    for (size_t i{}; i < train_order_.Size(); ++i) {
-        train_order_[i] = i;
-    }
-}
-
-/********************************************************************************
- * @note  Implementation details:
- *        1. The size of the train order vector is set to the number of stored
- *           training sets.
- *        2. The vector is assigned the index of each stored training set, e.g.
- *           0 - 9 if ten training sets are stored.
- ********************************************************************************/
-void LinReg::InitRandomGenerator(void) {
-    static bool random_generator_initialized{false};
-    if (!random_generator_initialized) {
-        srand(time(nullptr));
-        random_generator_initialized = true;
-    }
-}
-
+/********************************************************************************
+ * @brief Implementation details for the LinReg class.
+ ********************************************************************************/
+#include <lin_reg.hpp>
+#include <math.h>
+
+namespace yrgo {
+namespace {
+
+/********************************************************************************
+ * @brief The number of accumulators per sum in LinReg::Accumulate. Four lanes
+ *        of doubles fill a 256-bit vector register on the host, while AVR has
+ *        no vector registers, so one lane keeps the stack usage down there.
+ ********************************************************************************/
+#ifdef __AVR__
+constexpr size_t kLanes{1};
+#else
+constexpr size_t kLanes{4};
+#endif
+
+} /* namespace */
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The specified training data is copied and stored in vectors.
+ *        2. If the number of input and reference values don't match, the
+ *           superfluous values are deleted by resizing the corresponding vector.
+ *        3. The index of each training set is stored in the train order vector.
+ *        4. Any previous sample weights are removed, so all sets are weighted 1.0.
+ ********************************************************************************/
+void LinReg::LoadTrainingData(const container::Vector<double>& train_in, 
+                              const container::Vector<double>& train_out) {
+    train_in_ = train_in; 
+    train_out_ = train_out;
+    train_weights_.Clear();
+    MatchTrainingSets();
+    InitTrainOrderVector();
+    num_samples_ = train_in_.Size();
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Memory for the new sets is reserved in all vectors first, so no
+ *           vector is changed unless all sets fit. The capacity grows by at 
+ *           least 50 %, which makes repeated appends amortized O(1).
+ *        2. The weights are validated first. If a weight other than 1.0 is
+ *           appended to unweighted training data, the stored sets are weighted
+ *           1.0 explicitly first, so unweighted training data uses no memory
+ *           for weights.
+ *        3. The sets are pushed to the back of the training data and their
+ *           indexes to the train order vector. The existing training data and
+ *           training order are left untouched.
+ ********************************************************************************/
+bool LinReg::AppendTrainingData(const double* input, const double* reference, 
+                                const size_t num_sets, const double* weights) {
+    const auto size{train_in_.Size() + num_sets};
+    auto weighted{!train_weights_.Empty()};
+    for (size_t i{}; weights != nullptr && i < num_sets; ++i) {
+        if (!(weights[i] >= 0)) return false;
+        if (weights[i] != 1.0) weighted = true;
+    }
+    if (weighted && train_weights_.Empty() && !InitSampleWeights(size)) return false;
+    if (!ReserveTrainingData(size)) return false;
+    for (size_t i{}; i < num_sets; ++i) {
+        train_order_.PushBack(train_in_.Size());
+        train_in_.PushBack(input[i]);
+        train_out_.PushBack(reference[i]);
+        if (weighted) train_weights_.PushBack(weights != nullptr ? weights[i] : 1.0);
+    }
+    num_samples_ += num_sets;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If more sets than the capacity are stored, the sets to keep are
+ *           selected by a partial Fisher-Yates shuffle, i.e. each of the first
+ *           capacity positions is swapped with a random position at or after 
+ *           it. The kept sets are then a uniform random subset.
+ *        2. The vectors are shrunk to the capacity and the training order is
+ *           reinitialized, since it may hold indexes of removed sets. If a 
+ *           reallocation fails, the vectors are matched to the smallest size,
+ *           so the stored sets stay consistent, and the capacity is unchanged.
+ ********************************************************************************/
+bool LinReg::SetTrainingCapacity(const size_t capacity, const Sampling sampling) {
+    const auto num_sets{train_in_.Size()};
+    if (capacity > 0 && num_sets > capacity) {
+        for (size_t i{}; i < capacity; ++i) {
+            const auto r{i + random_.Next(num_sets - i)};
+            const auto input{train_in_[i]}, reference{train_out_[i]};
+            train_in_[i] = train_in_[r];
+            train_out_[i] = train_out_[r];
+            train_in_[r] = input;
+            train_out_[r] = reference;
+            if (!train_weights_.Empty()) {
+                const auto weight{train_weights_[i]};
+                train_weights_[i] = train_weights_[r];
+                train_weights_[r] = weight;
+            }
+        }
+        const auto shrunk{train_in_.Resize(capacity) && train_out_.Resize(capacity)};
+        MatchTrainingSets();
+        if (!train_weights_.Empty() && !train_weights_.Resize(train_in_.Size())) {
+            train_weights_.Clear();
+        }
+        InitTrainOrderVector();
+        if (!shrunk) return false;
+    }
+    capacity_ = capacity;
+    sampling_ = sampling;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Below the capacity (or if unlimited), the sample is appended to
+ *           the training data.
+ *        2. Else, with uniform sampling (reservoir sampling), the n:th sample
+ *           replaces a random stored sample with probability capacity / n,
+ *           which keeps every sample added so far equally likely to be stored.
+ *        3. With decayed sampling, the sample always replaces a random stored
+ *           sample.
+ *        4. A replaced sample also gets the weight of the new sample. The weight
+ *           doesn't affect the sampling, since the weight already sets how much
+ *           the sample counts once stored.
+ ********************************************************************************/
+bool LinReg::AddTrainingSample(const double input, const double reference, const double weight) {
+    if (!(weight >= 0)) return false;
+    if (capacity_ == 0 || train_in_.Size() < capacity_) {
+        return AppendTrainingData(input, reference, weight);
+    }
+    num_samples_++;
+    const auto r{random_.Next(sampling_ == Sampling::kUniform ? num_samples_ : capacity_)};
+    if (r >= capacity_) return false;
+    if (weight != 1.0 && train_weights_.Empty() && !InitSampleWeights(train_in_.Size())) {
+        return false;
+    }
+    train_in_[r] = input;
+    train_out_[r] = reference;
+    if (!train_weights_.Empty()) train_weights_[r] = weight;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. All weights are validated before anything is changed.
+ *        2. The weight vector is resized before the weights are copied, which
+ *           leaves the previous weights in place if the allocation fails.
+ ********************************************************************************/
+bool LinReg::SetSampleWeights(const container::Vector<double>& weights) {
+    if (weights.Size() != train_in_.Size()) return false;
+    for (const auto& weight : weights) {
+        if (!(weight >= 0)) return false;
+    }
+    if (!train_weights_.Resize(weights.Size())) return false;
+    for (size_t i{}; i < weights.Size(); ++i) {
+        train_weights_[i] = weights[i];
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Memory for the specified capacity is reserved before any weight is
+ *           pushed, so the weights are either all stored or not at all.
+ ********************************************************************************/
+bool LinReg::InitSampleWeights(const size_t capacity) {
+    if (!train_weights_.Reserve(capacity > train_in_.Size() ? capacity : train_in_.Size())) {
+        return false;
+    }
+    while (train_weights_.Size() < train_in_.Size()) {
+        train_weights_.PushBack(1.0);
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If the capacity is exceeded, it's increased by at least 50 % to 
+ *           keep the number of reallocations low when sets are appended one 
+ *           at a time. The growth is limited to the training capacity (if 
+ *           set), so a capped store never reserves more slots than it can use.
+ *        2. Memory for the weights is only reserved if the sets are weighted.
+ ********************************************************************************/
+bool LinReg::ReserveTrainingData(const size_t num_sets) {
+    const auto weighted{!train_weights_.Empty()};
+    if (num_sets <= train_in_.Capacity() && num_sets <= train_out_.Capacity() &&
+        num_sets <= train_order_.Capacity() && 
+        (!weighted || num_sets <= train_weights_.Capacity())) {
+        return true;
+    }
+    auto grown{train_in_.Capacity() + train_in_.Capacity() / 2 + 1};
+    if (capacity_ > 0 && grown > capacity_) grown = capacity_;
+    const auto capacity{grown > num_sets ? grown : num_sets};
+    return train_in_.Reserve(capacity) && train_out_.Reserve(capacity) && 
+           train_order_.Reserve(capacity) && (!weighted || train_weights_.Reserve(capacity));
+}
+
+/********************************************************************************
+ * @note Implementation details:
+ *        1. The model is trained with all stored training sets and their
+ *           weights (if any).
+ ********************************************************************************/
+void LinReg::Train(const size_t num_epochs, const double learning_rate) {
+    Train(train_in_.Data(), train_out_.Data(), train_order_.Data(), train_order_.Size(),
+          num_epochs, learning_rate, train_weights_.Empty() ? nullptr : train_weights_.Data());
+}
+
+/********************************************************************************
+ * @note Implementation details:
+ *        1. The published parameters are copied to the inactive buffer, which
+ *           is trained while predictions keep using the published parameters.
+ *        2. A loop is generated to run num_epochs number of times.
+ *        3. The training order is randomized before the training begins.
+ *        4. We train the model with all the training sets one by one.
+ *        5. We fetch the index of the training set and optimize out model.
+ *        6. The trained parameters are published when all epochs are done.
+ *        7. The epoch counter is incremented for each epoch, so the training 
+ *           state tells how far the training has come.
+ *        8. If telemetry is attached and the epoch is due to be recorded, the 
+ *           epoch is trained with loss calculation and timed, and the loss and
+ *           parameter deltas are recorded. Other epochs skip all of this.
+ ********************************************************************************/
+void LinReg::Train(const double* train_in, const double* train_out, size_t* train_order, 
+                   const size_t num_sets, const size_t num_epochs, const double learning_rate,
+                   const double* train_weights) {
+    auto& parameters{InactiveParameters()};
+    parameters = ActiveParameters();
+    for (size_t i{}; i < num_epochs; ++i) {
+        RandomizeTrainingOrder(train_order, num_sets);
+        epoch_++;
+        if (telemetry_ == nullptr || !telemetry_->Due(epoch_)) {
+            TrainEpoch<false>(parameters, train_in, train_out, train_weights, train_order, 
+                              num_sets, learning_rate);
+            continue;
+        }
+        const auto previous{parameters};
+        const auto start{telemetry_->Ticks()};
+        const auto loss{TrainEpoch<true>(parameters, train_in, train_out, train_weights, 
+                                         train_order, num_sets, learning_rate)};
+        telemetry_->Add({epoch_, loss, parameters.weight - previous.weight, 
+                         parameters.bias - previous.bias, telemetry_->Ticks() - start});
+    }
+    PublishParameters();
+}
+
+/********************************************************************************
+ * @note Implementation details:
+ *        1. We fetch the index of each training set and optimize our model.
+ *        2. The learning rate of each set is scaled by its weight, so a set with
+ *           weight w moves the parameters (to first order) as much as w copies
+ *           of the set, while each set is still visited once per epoch.
+ *        3. If the loss is calculated, the weighted squared error of each set is
+ *           summed and divided by the sum of the weights.
+ ********************************************************************************/
+template <bool kCalculateLoss>
+double LinReg::TrainEpoch(Parameters& parameters, const double* train_in, const double* train_out, 
+                          const double* train_weights, const size_t* train_order, 
+                          const size_t num_sets, const double learning_rate) {
+    double sum{}, sum_weights{};
+    for (size_t j{}; j < num_sets; ++j) { 
+        const auto index{train_order[j]};
+        const auto weight{train_weights != nullptr ? train_weights[index] : 1.0};
+        const auto error{Optimize(parameters, train_in[index], train_out[index], 
+                                  learning_rate * weight)};
+        if (kCalculateLoss) {
+            sum += weight * error * error;
+            sum_weights += weight;
+        }
+    }
+    return kCalculateLoss && sum_weights > 0 ? sum / sum_weights : 0.0;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each bin counts as one set with its mean as reference, weighted by
+ *           its number of samples, so the weighted least squares solution is 
+ *           the same as for all samples stored individually.
+ *        2. The parameters are written to the inactive buffer and published.
+ ********************************************************************************/
+bool LinReg::Fit(const Histogram& histogram, const double scale, const double offset) {
+    if (histogram.NumBins() < 2) return false;
+    const auto& bins{histogram.Bins()};
+    auto& parameters{InactiveParameters()};
+    const auto fitted{FitWeighted(bins.Size(), [&](const size_t i, double& x, double& y, double& w) {
+        x = bins[i].code * scale + offset;
+        y = bins[i].mean;
+        w = bins[i].count;
+    }, parameters)};
+    if (fitted) PublishParameters();
+    return fitted;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each stored training set is weighted by its sample weight, i.e. 1.0
+ *           if the sets are unweighted.
+ *        2. The parameters are written to the inactive buffer and published.
+ ********************************************************************************/
+bool LinReg::Fit(void) {
+    auto& parameters{InactiveParameters()};
+    const auto fitted{FitWeighted(train_in_.Size(), [this](const size_t i, double& x, double& y, double& w) {
+        x = train_in_[i];
+        y = train_out_[i];
+        w = SampleWeight(i);
+    }, parameters)};
+    if (fitted) PublishParameters();
+    return fitted;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The published parameters are read once, so the whole evaluation is
+ *           done with the same parameters even if the model is retrained.
+ *        2. Each set is predicted once. The squared, absolute and maximum 
+ *           errors and the sums of the shifted reference values are updated 
+ *           in the same pass, without branches.
+ *        3. Each sum is accumulated in kLanes independent lanes, which are
+ *           combined at the end. The compiler may not reorder floating-point
+ *           additions itself, so a single accumulator keeps the loop scalar,
+ *           while the lanes map onto one vector register per sum. The sets
+ *           left over after the last full group are added to the first lane.
+ ********************************************************************************/
+LinReg::ErrorSums LinReg::Accumulate(const double* input, const double* reference, 
+                                     const size_t num_sets, const double shift) const {
+    const auto parameters{ActiveParameters()};
+    double sum_squares[kLanes]{}, sum_abs[kLanes]{}, max_abs[kLanes]{};
+    double sum_ref[kLanes]{}, sum_ref_squares[kLanes]{};
+    const auto update{[&](const size_t lane, const size_t i) {
+        const auto error{reference[i] - Predict(parameters, input[i])};
+        const auto abs_error{fabs(error)};
+        const auto ref{reference[i] - shift};
+        sum_squares[lane] += error * error;
+        sum_abs[lane] += abs_error;
+        max_abs[lane] = abs_error > max_abs[lane] ? abs_error : max_abs[lane];
+        sum_ref[lane] += ref;
+        sum_ref_squares[lane] += ref * ref;
+    }};
+    size_t i{};
+    for (; i + kLanes <= num_sets; i += kLanes) {
+        for (size_t lane{}; lane < kLanes; ++lane) {
+            update(lane, i + lane);
+        }
+    }
+    for (; i < num_sets; ++i) {
+        update(0, i);
+    }
+    ErrorSums sums{num_sets, 0.0, 0.0, 0.0, shift, 0.0, 0.0};
+    for (size_t lane{}; lane < kLanes; ++lane) {
+        sums.sum_squares += sum_squares[lane];
+        sums.sum_abs += sum_abs[lane];
+        if (max_abs[lane] > sums.max_abs) sums.max_abs = max_abs[lane];
+        sums.sum_ref += sum_ref[lane];
+        sums.sum_ref_squares += sum_ref_squares[lane];
+    }
+    return sums;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The counts and sums are added and the largest maximum error kept.
+ ********************************************************************************/
+void LinReg::Merge(ErrorSums& destination, const ErrorSums& source) {
+    destination.num_sets += source.num_sets;
+    destination.sum_squares += source.sum_squares;
+    destination.sum_abs += source.sum_abs;
+    if (source.max_abs > destination.max_abs) destination.max_abs = source.max_abs;
+    destination.sum_ref += source.sum_ref;
+    destination.sum_ref_squares += source.sum_ref_squares;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The total sum of squares of the references is calculated from the
+ *           shifted sums as
+ *
+ *                     ss_tot = sum(d^2) - sum(d)^2 / n,  d = y_ref - shift,
+ *
+ *           which equals the sum of squared deviations from the mean.
+ *        2. R^2 is calculated as 1 - ss_res / ss_tot, where ss_res is the sum
+ *           of squared errors.
+ ********************************************************************************/
+LinReg::Metrics LinReg::Finalize(const ErrorSums& sums) {
+    if (sums.num_sets == 0) return {0.0, 0.0, 0.0, 0.0, 0.0};
+    const auto mse{sums.sum_squares / sums.num_sets};
+    const auto ss_tot{sums.sum_ref_squares - sums.sum_ref * sums.sum_ref / sums.num_sets};
+    return {mse, sqrt(mse), sums.sum_abs / sums.num_sets, sums.max_abs, 
+            ss_tot > 0 ? 1.0 - sums.sum_squares / ss_tot : 0.0};
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. A threshold that isn't positive (or NaN) is rejected, since it would
+ *           give every set a zero or negative Huber weight.
+ *        2. The (sample weighted) least squares solution is used as starting point.
+ *        3. For each iteration, the Huber weight of each training set is
+ *           calculated from its residual with the previous parameters and
+ *           multiplied by its sample weight, and the weighted least squares
+ *           problem is solved. The weights are computed on the fly in each pass,
+ *           so no extra memory is needed.
+ *        4. The iterations are stopped when the weight and bias change less
+ *           than the tolerance or the maximum number of iterations is reached.
+ *        5. The parameters are trained in the inactive buffer and published 
+ *           when done, so ongoing predictions aren't affected.
+ ********************************************************************************/
+bool LinReg::FitRobust(const double threshold, const size_t max_iterations, 
+                       const double tolerance) {
+    if (!(threshold > 0)) return false;
+    auto& parameters{InactiveParameters()};
+    Parameters previous{};
+    bool reweight{false};
+    const auto set{[&](const size_t i, double& x, double& y, double& w) {
+        x = train_in_[i];
+        y = train_out_[i];
+        w = SampleWeight(i);
+        if (!reweight) return;
+        const auto residual{fabs(y - Predict(previous, x))};
+        if (residual > threshold) w *= threshold / residual;
+    }};
+
+    if (!FitWeighted(train_in_.Size(), set, parameters)) return false;
+    reweight = true;
+    for (size_t i{}; i < max_iterations; ++i) {
+        previous = parameters;
+        if (!FitWeighted(train_in_.Size(), set, parameters)) break;
+        if (fabs(parameters.weight - previous.weight) < tolerance && 
+            fabs(parameters.bias - previous.bias) < tolerance) {
+            break;
+        }
+    }
+    PublishParameters();
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. We iterate through the training order vector.
+ *        2. We generate a random index between 0 - num_sets - 1.
+ *           For instance, if the training order vector has five elements, we
+ *           generate a random number between 0 - 4.
+ *        3. We swap the values of index i and r in the vector.
+ ********************************************************************************/
+void LinReg::RandomizeTrainingOrder(size_t* train_order, const size_t num_sets) {
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto r{random_.Next(num_sets)};
+        const auto temp{train_order[i]};
+        train_order[i] = train_order[r];
+        train_order[r] = temp;
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. We predict with the input and optimize according to the error.
+ *        2. Sets with x = 0 only adjust the bias, since the gradient of the 
+ *           weight is zero. The bias is adjusted by the learning rate like for
+ *           any other set rather than overwritten with y_ref, so a single noisy 
+ *           reading at x = 0 doesn't discard everything learned so far.
+ ********************************************************************************/
+double LinReg::Optimize(Parameters& parameters, const double input, 
+                        const double reference, const double learning_rate) {
+    const auto error{reference - Predict(parameters, input)}; /* error = y_ref - y_pred */
+    parameters.bias += error * learning_rate;                 /* m = m + error * LR */
+    parameters.weight += error * learning_rate * input;       /* k = k + error * LR * x */
+    return error;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The training order is validated before anything is changed, so an
+ *           incompatible state leaves the model untouched.
+ *        2. The training order, epoch counter and random generator state are 
+ *           restored and the parameters published.
+ ********************************************************************************/
+bool LinReg::RestoreTrainingState(const TrainingState& state, const size_t* train_order, 
+                                  const size_t num_sets) {
+    if (num_sets != train_in_.Size() || train_order_.Size() != num_sets) return false;
+    for (size_t i{}; i < num_sets; ++i) {
+        if (train_order[i] >= num_sets) return false;
+    }
+    for (size_t i{}; i < num_sets; ++i) {
+        train_order_[i] = train_order[i];
+    }
+    epoch_ = state.epoch;
+    random_.SetState(state.random_state);
+    InactiveParameters() = state.parameters;
+    PublishParameters();
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If the number of input and reference values don't match, i.e. the
+ *           size of the train_in_ and train_out_ vectors don't match, the
+ *           superfluous values are removed by resizing the larger vector to the
+ *           size of the smaller one.
+ ********************************************************************************/
+void LinReg::MatchTrainingSets(void) {
+    if (train_in_.Size() != train_out_.Size()) {
+        const auto num_sets{train_in_.Size() < train_out_.Size() ? 
+                            train_in_.Size() : train_out_.Size()};
+        train_in_.Resize(num_sets);
+        train_out_.Resize(num_sets);
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The size of the train order vector is set to the number of stored
+ *           training sets.
+ *        2. The vector is assigned the index of each stored training set, e.g.
+ *           0 - 9 if ten training sets are stored.
+ ********************************************************************************/
+void LinReg::InitTrainOrderVector(void) {
+    train_order_.Resize(train_in_.Size());
+    for (size_t i{}; i < train_order_.Size(); ++i) {
+        train_order_[i] = i;
+    }
+}
+
 } /* namespace yrgo */
\ No newline at end of file
@@ -1,123 +1,809 @@
-/********************************************************************************
- * @brief Library for implementing linear regression models in C++.
- ********************************************************************************/
-#pragma once
-
-#include <vector.hpp>
-#include <stdlib.h>
-#include <time.h>
-
-
-namespace yrgo {
-
-/********************************************************************************
- * @brief Class for implementing linear regression models.
- ********************************************************************************/
-class LinReg {
-  public:
-
-    /********************************************************************************
-     * @brief Default constructor, creates empty regression model.
-     ********************************************************************************/
-    LinReg(void) = default;
-
-    /********************************************************************************
-     * @brief Creates new regression model and stores referenced training data.
-     * 
-     * @param train_in
-     *        Reference to vector containing input data (x).
-     * @param train_out
-     *        Reference to vector containing reference data (y_ref).
-     ********************************************************************************/
-    LinReg(const container::Vector<double>& train_in, const container::Vector<double>& train_out) {
-        LoadTrainingData(train_in, train_out);
-    }
-
-    /********************************************************************************
-     * @brief Makes a prediction with the specified input value. 
-     *        The prediction is calculated as 
-     * 
-     *                                y_pred = kx + m,
-     *  
-     * where x is the specified input value, k is the weight and m is the bias.
-     *        
-     * @param input
-     *        The input value (x) to predict with.
-     * @return
-     *        The predicted value (y_pred).
-     ********************************************************************************/
-    double Predict(const double input) const { return weight_ * input + bias_; }
-
-    /********************************************************************************
-     * @brief Loads training data from referenced vectors.
-     * 
-     * @param train_in
-     *        Reference to vector containing input data (x).
-     * @param train_out
-     *        Reference to vector containing reference data (y_ref).
-     ********************************************************************************/
-    void LoadTrainingData(const container::Vector<double>& train_in, 
-                          const container::Vector<double>& train_out);
-
-    /********************************************************************************
-     * @brief Trains regression model with specified parameters.
-     * 
-     * @param num_epochs
-     *        The number of epochs (turns) to train.
-     * @param learning_rate
-     *        The learning rate, sets the change rate during errors (default = 0.01).
-     ********************************************************************************/
-    void Train(const size_t num_epochs, const double learning_rate = 0.01);
-
-  /********************************************************************************
-   * @note The private segment is only visible internally (i.e. in this class).
-   ********************************************************************************/
-  private:
-    container::Vector<double> train_in_{};         /* Input values (x). */
-    container::Vector<double> train_out_{};        /* Reference values (y_ref). */
-    container::Vector<size_t> train_order_{}; /* Stores indexes for training sets. */
-    double weight_{};                        /* k-value. */
-    double bias_{};                          /* m-value. */
-
-    /********************************************************************************
-     * @brief Randomizes the training order before each new epoch. This is done to
-     *        prevent that the model is learning due to the order of the training
-     *        sets.
-     ********************************************************************************/
-    void RandomizeTrainingOrder(void);
-
-    /********************************************************************************
-     * @brief Optimizes the model by making a prediction and adjusting the 
-     *        parameters according to the calculated error.
-     * 
-     * @param input
-     *        The input value of the model (x).
-     * @param reference
-     *        The reference value of the model (y_ref).
-     * @param learning_rate
-     *        The learning rate, sets the change rate during errors.
-     ********************************************************************************/
-    void Optimize(const double input, const double reference, const double learning_rate);
-
-    /********************************************************************************
-     * @brief Ensures the the vectors storing the training sets are of equal size. 
-     *        If not, the superfluous values of the larger vector is removed.
-     ********************************************************************************/
-    void MatchTrainingSets(void);
-
-     /********************************************************************************
-     * @brief Initializes the training order vector so that it stores the index of
-     *        each training set.
-     ********************************************************************************/
-    void InitTrainOrderVector(void);
- 
-    /********************************************************************************
-     * @brief Initializes the random generator. This function should preferably be
-     *        called before using the rand function to ensure that the 
-     *        randomized sequence is unique each time the program is run.
-     ********************************************************************************/
-    static void InitRandomGenerator(void);
-};
-
-} /* namespace yrgo */
-
+/********************************************************************************
+ * @brief Library for implementing linear regression models in C++.
+ ********************************************************************************/
+#pragma once
+
+#include <vector.hpp>
+#include <histogram.hpp>
+#include <training_telemetry.hpp>
+#include <xorshift.hpp>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing linear regression models.
+ ********************************************************************************/
+class LinReg {
+  public:
+
+    /********************************************************************************
+     * @brief Struct holding the trained parameters of the model. The struct is
+     *        trivially copyable, so it can be stored as is, e.g. in EEPROM.
+     *
+     * @param weight
+     *        The weight (k-value) of the model.
+     * @param bias
+     *        The bias (m-value) of the model.
+     ********************************************************************************/
+    struct Parameters {
+        double weight;
+        double bias;
+    };
+
+    /********************************************************************************
+     * @brief Struct holding the state needed to resume training exactly where it
+     *        was stopped (together with the training order).
+     *
+     * @param parameters
+     *        The published weight and bias of the model.
+     * @param epoch
+     *        The number of epochs trained so far.
+     * @param random_state
+     *        The state of the random generator used to shuffle the training order.
+     ********************************************************************************/
+    struct TrainingState {
+        Parameters parameters;
+        uint32_t epoch;
+        uint32_t random_state;
+    };
+
+    /********************************************************************************
+     * @brief Struct holding quality metrics of the model on a set of data.
+     *
+     * @param mse
+     *        The mean squared error.
+     * @param rmse
+     *        The root mean squared error, in the unit of y_ref.
+     * @param mae
+     *        The mean absolute error.
+     * @param max_error
+     *        The largest absolute error.
+     * @param r2
+     *        The coefficient of determination, i.e. the share of the variance
+     *        of y_ref explained by the model (1 = perfect fit). Set to 0 if all
+     *        reference values are equal.
+     ********************************************************************************/
+    struct Metrics {
+        double mse;
+        double rmse;
+        double mae;
+        double max_error;
+        double r2;
+    };
+
+    /********************************************************************************
+     * @brief Struct holding the partial sums needed to calculate the metrics.
+     *        Partial sums of separate parts of the data can be merged, so the
+     *        evaluation of large datasets can be split between threads.
+     *
+     * @param num_sets
+     *        The number of evaluated sets.
+     * @param sum_squares
+     *        The sum of squared errors.
+     * @param sum_abs
+     *        The sum of absolute errors.
+     * @param max_abs
+     *        The largest absolute error.
+     * @param shift
+     *        Value subtracted from each reference value before summing it, which
+     *        keeps the variance accurate when the references are far from zero.
+     *        Must be the same for partial sums to be merged.
+     * @param sum_ref
+     *        The sum of shifted reference values.
+     * @param sum_ref_squares
+     *        The sum of squared shifted reference values.
+     ********************************************************************************/
+    struct ErrorSums {
+        size_t num_sets;
+        double sum_squares;
+        double sum_abs;
+        double max_abs;
+        double shift;
+        double sum_ref;
+        double sum_ref_squares;
+    };
+
+    /********************************************************************************
+     * @brief Enumeration class for selecting how samples are replaced once the
+     *        training capacity is reached.
+     *
+     * @param kUniform
+     *        Reservoir sampling, every sample added so far is equally likely to
+     *        be stored.
+     * @param kDecayed
+     *        Each new sample replaces a random stored sample, so the probability
+     *        of a sample being stored decays exponentially with its age.
+     ********************************************************************************/
+    enum class Sampling { kUniform, kDecayed };
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty regression model.
+     ********************************************************************************/
+    LinReg(void) = default;
+
+    /********************************************************************************
+     * @brief Creates new regression model and stores referenced training data.
+     * 
+     * @param train_in
+     *        Reference to vector containing input data (x).
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref).
+     ********************************************************************************/
+    LinReg(const container::Vector<double>& train_in, const container::Vector<double>& train_out) {
+        LoadTrainingData(train_in, train_out);
+    }
+
+    /********************************************************************************
+     * @brief Creates new regression model and stores referenced weighted training
+     *        data.
+     * 
+     * @param train_in
+     *        Reference to vector containing input data (x).
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref).
+     * @param weights
+     *        Reference to vector containing the weight of each training set.
+     ********************************************************************************/
+    LinReg(const container::Vector<double>& train_in, const container::Vector<double>& train_out,
+           const container::Vector<double>& weights) {
+        LoadTrainingData(train_in, train_out, weights);
+    }
+
+    /********************************************************************************
+     * @brief Makes a prediction with the specified input value. 
+     *        The prediction is calculated as 
+     * 
+     *                                y_pred = kx + m,
+     *  
+     * where x is the specified input value, k is the weight and m is the bias.
+     * The weight and bias are always read from the same published parameter set,
+     * so this function can be called from ISRs while the model is retrained.
+     *        
+     * @param input
+     *        The input value (x) to predict with.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    double Predict(const double input) const { return Predict(ActiveParameters(), input); }
+
+    /********************************************************************************
+     * @brief Provides the trained parameters of the model.
+     *
+     * @return
+     *        The weight and bias of the model.
+     ********************************************************************************/
+    Parameters GetParameters(void) const { return ActiveParameters(); }
+
+    /********************************************************************************
+     * @brief Sets the parameters of the model, for instance parameters trained
+     *        earlier and restored from EEPROM.
+     *
+     * @param parameters
+     *        Reference to the new weight and bias of the model.
+     ********************************************************************************/
+    void SetParameters(const Parameters& parameters) { 
+        InactiveParameters() = parameters;
+        PublishParameters();
+    }
+
+    /********************************************************************************
+     * @brief Provides the training state of the model, i.e. the parameters, the
+     *        number of trained epochs and the state of the random generator.
+     *
+     * @return
+     *        The training state.
+     ********************************************************************************/
+    TrainingState GetTrainingState(void) const { 
+        return {ActiveParameters(), epoch_, random_.State()}; 
+    }
+
+    /********************************************************************************
+     * @brief Provides the current training order, i.e. the indexes of the stored
+     *        training sets in the order they were trained during the last epoch.
+     *
+     * @return
+     *        Reference to vector holding the training order.
+     ********************************************************************************/
+    const container::Vector<size_t>& TrainingOrder(void) const { return train_order_; }
+
+    /********************************************************************************
+     * @brief Restores a training state saved earlier with the same training data. 
+     *        Training then continues exactly as if it was never stopped.
+     *
+     * @param state
+     *        Reference to the training state to restore.
+     * @param train_order
+     *        Pointer to array holding the saved training order.
+     * @param num_sets
+     *        The number of indexes in the array.
+     * @return
+     *        True if the state was restored, false if the number of sets doesn't
+     *        match the stored training data or an index is out of range.
+     ********************************************************************************/
+    bool RestoreTrainingState(const TrainingState& state, const size_t* train_order, 
+                              const size_t num_sets);
+
+    /********************************************************************************
+     * @brief Seeds the random generator of the model, which makes the training 
+     *        reproducible. If never called, the generator is seeded from the 
+     *        time the first time it's used.
+     *
+     * @param seed
+     *        The seed to use (0 is replaced by 1).
+     ********************************************************************************/
+    void SetRandomSeed(const uint32_t seed) { random_.Seed(seed); }
+
+    /********************************************************************************
+     * @brief Attaches telemetry recording the convergence of subsequent training,
+     *        or detaches the telemetry. The telemetry isn't owned by the model.
+     *
+     * @param telemetry
+     *        Pointer to the telemetry, or nullptr to detach (default = nullptr).
+     ********************************************************************************/
+    void SetTelemetry(TrainingTelemetry* telemetry = nullptr) { telemetry_ = telemetry; }
+
+    /********************************************************************************
+     * @brief Loads training data from referenced vectors.
+     * 
+     * @param train_in
+     *        Reference to vector containing input data (x).
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref).
+     ********************************************************************************/
+    void LoadTrainingData(const container::Vector<double>& train_in, 
+                          const container::Vector<double>& train_out);
+
+    /********************************************************************************
+     * @brief Loads weighted training data from referenced vectors. A set with 
+     *        weight w counts as w copies of the set, both in training and in the
+     *        closed-form fits, without being stored more than once.
+     * 
+     * @param train_in
+     *        Reference to vector containing input data (x).
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref).
+     * @param weights
+     *        Reference to vector containing the weight of each training set.
+     * @return
+     *        True if the weights were stored, false if the number of weights 
+     *        doesn't match the number of sets, a weight is negative or the memory 
+     *        allocation failed (the training data is then loaded unweighted).
+     ********************************************************************************/
+    bool LoadTrainingData(const container::Vector<double>& train_in, 
+                          const container::Vector<double>& train_out,
+                          const container::Vector<double>& weights) {
+        LoadTrainingData(train_in, train_out);
+        return SetSampleWeights(weights);
+    }
+
+    /********************************************************************************
+     * @brief Appends a training set to the stored training data. The storage
+     *        grows geometrically, so appending is amortized constant time, and
+     *        the index of the new set is added to the training order. The model
+     *        parameters are kept, so subsequent training continues from them.
+     * 
+     * @param input
+     *        The input value (x).
+     * @param reference
+     *        The reference value (y_ref).
+     * @param weight
+     *        The weight of the set (default = 1.0).
+     * @return
+     *        True if the set was appended, false if the weight is negative or the 
+     *        memory allocation failed.
+     ********************************************************************************/
+    bool AppendTrainingData(const double input, const double reference, const double weight = 1.0) {
+        return AppendTrainingData(&input, &reference, 1, &weight);
+    }
+
+    /********************************************************************************
+     * @brief Appends training sets to the stored training data. Either all or 
+     *        none of the sets are appended.
+     * 
+     * @param input
+     *        Pointer to array containing input data (x).
+     * @param reference
+     *        Pointer to array containing reference data (y_ref).
+     * @param num_sets
+     *        The number of sets to append.
+     * @param weights
+     *        Pointer to array containing the weight of each set (default = nullptr,
+     *        all sets weighted 1.0).
+     * @return
+     *        True if the sets were appended, false if a weight is negative or the
+     *        memory allocation failed.
+     ********************************************************************************/
+    bool AppendTrainingData(const double* input, const double* reference, const size_t num_sets,
+                            const double* weights = nullptr);
+
+    /********************************************************************************
+     * @brief Appends training sets from referenced vectors to the stored training
+     *        data. If the sizes of the vectors don't match, the superfluous values
+     *        of the larger vector are ignored.
+     * 
+     * @param train_in
+     *        Reference to vector containing input data (x).
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref).
+     * @return
+     *        True if the sets were appended, false if the memory allocation failed.
+     ********************************************************************************/
+    bool AppendTrainingData(const container::Vector<double>& train_in, 
+                            const container::Vector<double>& train_out) {
+        const auto num_sets{train_in.Size() < train_out.Size() ? train_in.Size() : train_out.Size()};
+        return AppendTrainingData(train_in.Data(), train_out.Data(), num_sets);
+    }
+
+    /********************************************************************************
+     * @brief Limits the number of stored training sets. Once the capacity is
+     *        reached, new samples added via AddTrainingSample replace stored
+     *        samples according to the selected sampling, which keeps both the
+     *        memory usage and the training time per epoch constant. If more sets
+     *        than the capacity are already stored, a random subset of them is 
+     *        kept and the rest are removed, so the stored sets remain a uniform
+     *        sample.
+     * 
+     * @param capacity
+     *        The maximum number of stored training sets (0 = unlimited).
+     * @param sampling
+     *        The sampling used when the capacity is reached (default = uniform).
+     * @return
+     *        True if the capacity was set, false if the memory reallocation 
+     *        failed when removing sets (the capacity is then unchanged).
+     ********************************************************************************/
+    bool SetTrainingCapacity(const size_t capacity, const Sampling sampling = Sampling::kUniform);
+
+    /********************************************************************************
+     * @brief Adds a training set to the stored training data. If the training
+     *        capacity is reached, the sample either replaces a stored sample or
+     *        is discarded, depending on the selected sampling.
+     * 
+     * @param input
+     *        The input value (x).
+     * @param reference
+     *        The reference value (y_ref).
+     * @param weight
+     *        The weight of the sample (default = 1.0). The weight doesn't affect
+     *        the probability of the sample being stored.
+     * @return
+     *        True if the sample was stored, false if it was discarded, the weight
+     *        is negative or the memory allocation failed.
+     ********************************************************************************/
+    bool AddTrainingSample(const double input, const double reference, const double weight = 1.0);
+
+    /********************************************************************************
+     * @brief Sets the weight of each stored training set. The weights are relative,
+     *        i.e. a set with weight 2 counts as two copies of the set, and are
+     *        applied to each update during training as well as to the closed-form
+     *        fits. Weights well above 1 scale the learning rate of their sets 
+     *        accordingly, so weights averaging around 1 keep the learning rate
+     *        meaningful.
+     * 
+     * @param weights
+     *        Reference to vector containing the weight of each stored training set.
+     * @return
+     *        True if the weights were stored, false if the number of weights 
+     *        doesn't match the number of stored sets, a weight is negative or the 
+     *        memory allocation failed (the weights are then left unchanged).
+     ********************************************************************************/
+    bool SetSampleWeights(const container::Vector<double>& weights);
+
+    /********************************************************************************
+     * @brief Removes the weights of the stored training sets, i.e. all sets are
+     *        weighted 1.0 again.
+     ********************************************************************************/
+    void ClearSampleWeights(void) { train_weights_.Clear(); }
+
+    /********************************************************************************
+     * @brief Provides the weights of the stored training sets.
+     *
+     * @return
+     *        Reference to vector holding the weight of each stored training set, 
+     *        empty if all sets are weighted 1.0.
+     ********************************************************************************/
+    const container::Vector<double>& SampleWeights(void) const { return train_weights_; }
+
+    /********************************************************************************
+     * @brief Provides the input values of the stored training sets.
+     *
+     * @return
+     *        Reference to vector holding the input value (x) of each stored set.
+     ********************************************************************************/
+    const container::Vector<double>& TrainingInput(void) const { return train_in_; }
+
+    /********************************************************************************
+     * @brief Provides the reference values of the stored training sets.
+     *
+     * @return
+     *        Reference to vector holding the reference value (y_ref) of each 
+     *        stored set.
+     ********************************************************************************/
+    const container::Vector<double>& TrainingOutput(void) const { return train_out_; }
+
+    /********************************************************************************
+     * @brief Trains regression model with specified parameters. The training 
+     *        starts from the current parameters (warm start), so training after
+     *        appending data only needs a few epochs.
+     * 
+     * @param num_epochs
+     *        The number of epochs (turns) to train.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors (default = 0.01).
+     ********************************************************************************/
+    void Train(const size_t num_epochs, const double learning_rate = 0.01);
+
+    /********************************************************************************
+     * @brief Trains regression model with training sets selected from external
+     *        data, for instance one fold of a cross-validation. The data isn't
+     *        copied, only the selected indexes are read.
+     * 
+     * @param train_in
+     *        Pointer to array containing input data (x).
+     * @param train_out
+     *        Pointer to array containing reference data (y_ref).
+     * @param train_order
+     *        Pointer to array holding the indexes of the sets to train with. The
+     *        array is shuffled before each epoch.
+     * @param num_sets
+     *        The number of indexes in the train order array.
+     * @param num_epochs
+     *        The number of epochs (turns) to train.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors (default = 0.01).
+     * @param train_weights
+     *        Pointer to array containing the weight of each set, indexed like the
+     *        input data (default = nullptr, all sets weighted 1.0).
+     ********************************************************************************/
+    void Train(const double* train_in, const double* train_out, size_t* train_order, 
+               const size_t num_sets, const size_t num_epochs, const double learning_rate = 0.01,
+               const double* train_weights = nullptr);
+
+    /********************************************************************************
+     * @brief Fits the model to the samples aggregated in specified histogram via
+     *        weighted least squares, where each bin counts as its mean weighted by
+     *        its number of samples. The fit time only depends on the number of
+     *        bins. The input (x) of each bin is calculated from its code as
+     *
+     *                                x = code * scale + offset,
+     *
+     *        for instance scale = 5.0 / 1023 to convert ADC codes to voltages.
+     *
+     * @param histogram
+     *        Reference to the histogram holding the training samples.
+     * @param scale
+     *        Scale factor from code to input value (default = 1.0).
+     * @param offset
+     *        Offset from code to input value (default = 0.0).
+     * @return
+     *        True if the model was fitted, false if less than two distinct codes
+     *        are stored in the histogram.
+     ********************************************************************************/
+    bool Fit(const Histogram& histogram, const double scale = 1.0, const double offset = 0.0);
+
+    /********************************************************************************
+     * @brief Fits the model to the stored training sets via (weighted) least
+     *        squares, i.e. the closed-form solution that SGD converges towards.
+     *
+     * @return
+     *        True if the model was fitted, false if less than two distinct inputs
+     *        with nonzero weights are stored.
+     ********************************************************************************/
+    bool Fit(void);
+
+    /********************************************************************************
+     * @brief Evaluates the model on specified data. All metrics are calculated
+     *        in one pass, with one prediction per set.
+     * 
+     * @param input
+     *        Pointer to array containing input data (x).
+     * @param reference
+     *        Pointer to array containing reference data (y_ref).
+     * @param num_sets
+     *        The number of sets to evaluate.
+     * @return
+     *        The metrics of the model (all zero if no sets are specified).
+     ********************************************************************************/
+    Metrics Evaluate(const double* input, const double* reference, const size_t num_sets) const {
+        return Finalize(Accumulate(input, reference, num_sets, num_sets > 0 ? reference[0] : 0.0));
+    }
+
+    /********************************************************************************
+     * @brief Evaluates the model on the stored training data.
+     * 
+     * @return
+     *        The metrics of the model (all zero if no training data is stored).
+     ********************************************************************************/
+    Metrics Evaluate(void) const {
+        return Evaluate(train_in_.Data(), train_out_.Data(), train_in_.Size());
+    }
+
+    /********************************************************************************
+     * @brief Calculates the partial sums of the metrics on specified data. The
+     *        loop is branch-free with the parameters held in locals, and each sum
+     *        is split into independent lanes, so it can be vectorized by the
+     *        compiler.
+     * 
+     * @param input
+     *        Pointer to array containing input data (x).
+     * @param reference
+     *        Pointer to array containing reference data (y_ref).
+     * @param num_sets
+     *        The number of sets to evaluate.
+     * @param shift
+     *        Value subtracted from each reference value, preferably a typical
+     *        reference value such as the first one.
+     * @return
+     *        The partial sums.
+     ********************************************************************************/
+    ErrorSums Accumulate(const double* input, const double* reference, const size_t num_sets,
+                         const double shift) const;
+
+    /********************************************************************************
+     * @brief Merges specified partial sums into the destination.
+     * 
+     * @param destination
+     *        Reference to the partial sums to merge into.
+     * @param source
+     *        Reference to the partial sums to merge, calculated with the same shift.
+     ********************************************************************************/
+    static void Merge(ErrorSums& destination, const ErrorSums& source);
+
+    /********************************************************************************
+     * @brief Calculates the metrics from specified partial sums.
+     * 
+     * @param sums
+     *        Reference to the partial sums.
+     * @return
+     *        The metrics (all zero if no sets were evaluated).
+     ********************************************************************************/
+    static Metrics Finalize(const ErrorSums& sums);
+
+    /********************************************************************************
+     * @brief Fits the model to the stored training sets with the Huber loss,
+     *        which is quadratic for residuals up to the specified threshold and
+     *        linear above it. Outliers, such as single bad reference readings,
+     *        therefore only have limited impact on the fitted parameters.
+     *
+     *        The fit is solved by iteratively reweighted least squares (IRLS),
+     *        starting from the ordinary least squares solution. Each iteration
+     *        weights every training set by
+     *
+     *                          w = 1                 if |r| <= threshold,
+     *                          w = threshold / |r|   otherwise,
+     *
+     *        where r is its residual, multiplied by its sample weight (if any), and
+     *        solves the weighted least squares problem in closed form. A handful
+     *        of iterations is usually enough.
+     *
+     * @param threshold
+     *        The residual (in the unit of y_ref) above which the loss is linear,
+     *        typically around 1.5 times the standard deviation of the noise.
+     *        Must be positive.
+     * @param max_iterations
+     *        The maximum number of reweighting iterations (default = 10).
+     * @param tolerance
+     *        Convergence limit for the change of the weight and bias between two
+     *        iterations (default = 1e-6).
+     * @return
+     *        True if the model was fitted, false if the threshold isn't positive
+     *        or less than two distinct inputs are stored.
+     ********************************************************************************/
+    bool FitRobust(const double threshold, const size_t max_iterations = 10, 
+                   const double tolerance = 1e-6);
+
+  /********************************************************************************
+   * @note The private segment is only visible internally (i.e. in this class).
+   ********************************************************************************/
+  private:
+    container::Vector<double> train_in_{};         /* Input values (x). */
+    container::Vector<double> train_out_{};        /* Reference values (y_ref). */
+    container::Vector<double> train_weights_{};    /* Set weights (empty = all 1.0). */
+    container::Vector<size_t> train_order_{}; /* Stores indexes for training sets. */
+    Parameters parameters_[2]{};             /* Double-buffered k- and m-values. */
+    volatile uint8_t active_{};              /* Index of the published parameters. */
+    size_t capacity_{};                      /* Maximum number of training sets. */
+    Sampling sampling_{Sampling::kUniform};  /* Sampling when the capacity is reached. */
+    uint32_t num_samples_{};                 /* Number of samples added so far. */
+    uint32_t epoch_{};                       /* Number of epochs trained so far. */
+    Xorshift32 random_{};                    /* Random generator of the model. */
+    TrainingTelemetry* telemetry_{};         /* Attached telemetry (if any). */
+
+    /********************************************************************************
+     * @brief Provides the published parameters. The index is read once, so the
+     *        weight and bias are always taken from the same buffer.
+     *
+     * @return
+     *        Reference to the published parameters.
+     ********************************************************************************/
+    const Parameters& ActiveParameters(void) const {
+        const auto& parameters{parameters_[active_]};
+        __atomic_signal_fence(__ATOMIC_ACQUIRE);
+        return parameters;
+    }
+
+    /********************************************************************************
+     * @brief Provides the unpublished parameters, which are updated during
+     *        training without affecting ongoing predictions.
+     *
+     * @return
+     *        Reference to the unpublished parameters.
+     ********************************************************************************/
+    Parameters& InactiveParameters(void) { return parameters_[active_ ^ 1]; }
+
+    /********************************************************************************
+     * @brief Publishes the inactive parameters by flipping the buffer index with
+     *        a single byte store. All writes to the inactive parameters are
+     *        completed before the flip. Readers in ISRs therefore see either the
+     *        old or the new parameters, never a mix of both. 
+     ********************************************************************************/
+    void PublishParameters(void) {
+        __atomic_signal_fence(__ATOMIC_RELEASE);
+        active_ = active_ ^ 1;
+    }
+
+    /********************************************************************************
+     * @brief Makes a prediction with specified parameters.
+     *
+     * @param parameters
+     *        Reference to the parameters to predict with.
+     * @param input
+     *        The input value (x) to predict with.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    static double Predict(const Parameters& parameters, const double input) {
+        return parameters.weight * input + parameters.bias;
+    }
+
+    /********************************************************************************
+     * @brief Solves the weighted least squares problem in closed form, i.e. the
+     *        weight and bias minimizing sum(w * (y_ref - (kx + m))^2). The sums
+     *        are calculated around the weighted means in two passes to avoid
+     *        cancellation errors in single-precision arithmetic.
+     *
+     * @param num_sets
+     *        The number of sets to fit.
+     * @param set
+     *        Callable set(index, x, y, w) assigning the input, reference and
+     *        weight of the set at specified index.
+     * @param parameters
+     *        Reference to the parameters to assign the solution to.
+     * @return
+     *        True if the problem was solved, false if the weights sum to zero or
+     *        all weighted inputs are equal (parameters are then left unchanged).
+     ********************************************************************************/
+    template <typename SetFunction>
+    static bool FitWeighted(const size_t num_sets, SetFunction set, Parameters& parameters) {
+        double x{}, y{}, w{}, sum_w{}, x_mean{}, y_mean{};
+        for (size_t i{}; i < num_sets; ++i) {
+            set(i, x, y, w);
+            sum_w += w;
+            x_mean += w * x;
+            y_mean += w * y;
+        }
+        if (sum_w <= 0) return false;
+        x_mean /= sum_w;
+        y_mean /= sum_w;
+
+        double sum_xx{}, sum_xy{};
+        for (size_t i{}; i < num_sets; ++i) {
+            set(i, x, y, w);
+            const auto dx{x - x_mean};
+            sum_xx += w * dx * dx;
+            sum_xy += w * dx * (y - y_mean);
+        }
+        if (sum_xx == 0) return false;
+        parameters.weight = sum_xy / sum_xx;
+        parameters.bias = y_mean - parameters.weight * x_mean;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Randomizes the training order before each new epoch. This is done to
+     *        prevent that the model is learning due to the order of the training
+     *        sets.
+     * 
+     * @param train_order
+     *        Pointer to array holding the indexes of the training sets.
+     * @param num_sets
+     *        The number of indexes in the array.
+     ********************************************************************************/
+    void RandomizeTrainingOrder(size_t* train_order, const size_t num_sets);
+
+    /********************************************************************************
+     * @brief Optimizes the model by making a prediction and adjusting the 
+     *        parameters according to the calculated error.
+     * 
+     * @param parameters
+     *        Reference to the parameters to optimize.
+     * @param input
+     *        The input value of the model (x).
+     * @param reference
+     *        The reference value of the model (y_ref).
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     * @return
+     *        The error before the adjustment (y_ref - y_pred).
+     ********************************************************************************/
+    static double Optimize(Parameters& parameters, const double input, 
+                           const double reference, const double learning_rate);
+
+    /********************************************************************************
+     * @brief Trains the model one epoch with the training sets in specified order.
+     * 
+     * @tparam kCalculateLoss
+     *        Indicates if the loss is to be calculated. If false, the loss isn't
+     *        calculated at all, so the epoch costs no more than without telemetry.
+     * @param parameters
+     *        Reference to the parameters to optimize.
+     * @param train_in
+     *        Pointer to array containing input data (x).
+     * @param train_out
+     *        Pointer to array containing reference data (y_ref).
+     * @param train_weights
+     *        Pointer to array containing the weight of each set, or nullptr if all
+     *        sets are weighted 1.0.
+     * @param train_order
+     *        Pointer to array holding the indexes of the sets to train with.
+     * @param num_sets
+     *        The number of indexes in the train order array.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     * @return
+     *        The weighted mean squared error before each adjustment if 
+     *        kCalculateLoss is true, else 0.
+     ********************************************************************************/
+    template <bool kCalculateLoss>
+    static double TrainEpoch(Parameters& parameters, const double* train_in, const double* train_out, 
+                             const double* train_weights, const size_t* train_order, 
+                             const size_t num_sets, const double learning_rate);
+
+    /********************************************************************************
+     * @brief Ensures the the vectors storing the training sets are of equal size. 
+     *        If not, the superfluous values of the larger vector is removed.
+     ********************************************************************************/
+    void MatchTrainingSets(void);
+
+    /********************************************************************************
+     * @brief Reserves memory for specified number of training sets in the vectors
+     *        storing the training data and the training order.
+     * 
+     * @param num_sets
+     *        The number of training sets to reserve memory for.
+     * @return
+     *        True if the memory is reserved, else false.
+     ********************************************************************************/
+    bool ReserveTrainingData(const size_t num_sets);
+
+    /********************************************************************************
+     * @brief Provides the weight of the stored training set at specified index.
+     ********************************************************************************/
+    double SampleWeight(const size_t index) const {
+        return train_weights_.Empty() ? 1.0 : train_weights_[index];
+    }
+
+    /********************************************************************************
+     * @brief Weights all stored training sets 1.0 explicitly, which is done the 
+     *        first time a set with another weight is added. Until then, no memory
+     *        is used for the weights.
+     * 
+     * @param capacity
+     *        The number of weights to reserve memory for.
+     * @return
+     *        True if the weights are stored, false if the memory allocation failed.
+     ********************************************************************************/
+    bool InitSampleWeights(const size_t capacity);
+
+     /********************************************************************************
+     * @brief Initializes the training order vector so that it stores the index of
+     *        each training set.
+     ********************************************************************************/
+    void InitTrainOrderVector(void);
+};
+
+} /* namespace yrgo */
+
@@ -1,122 +1,201 @@
-/********************************************************************************
- * @brief Demonstration of GPIO device drivers in C++.
- ********************************************************************************/
-#include <drivers.hpp> 
-#include <lin_reg.hpp>
-
-using namespace yrgo::driver;
-using namespace yrgo::container;
-
-/********************************************************************************
- * @brief Devices and models used in the embedded system.
- *
- * @param model
- *        Linear regression model for predicting the temperature.
- * @param button1
- *        Button used to toggle the LED between blinking and being disabled.
- * @param timer0
- *        Timer used to reduced the effect of contact bounces when pressing
- *        the button.
- * @param timer1
- *        Timer used to predict temp every 60 seconds.
- ********************************************************************************/
-static yrgo::LinReg model{};
-static GPIO tmp1{2, GPIO::Direction::kInput};
-static GPIO button1{13, GPIO::Direction::kInputPullup};
-static Timer timer0{Timer::Circuit::k0, 300};
-static Timer timer1{Timer::Circuit::k1, 60000};
-
-namespace {
-
-/*********************************************************************************
- * @brief Predicts and prints temperature based on input voltage.
- *
- * This function reads an analog voltage signal from channel 2 using the adc::Read function,
- * scales it to a voltage value between 0 and 5, and then uses a predictive model (presumably stored
- * in the 'model' variable) to estimate the temperature corresponding to the input voltage.
- * The predicted temperature is then rounded using the utils::Round function and printed to the serial output.
- **********************************************************************************/
-void PredictTemp(void) {
-	const double uin = adc::Read(2) / (double)adc::kMaxVal * 5.0;
-	const auto temp = model.Predict(uin);
-	serial::Printf("Temp: %d\n", utils::Round(temp));
-}
-
-/********************************************************************************
- * @brief Callback routine called when button1 is pressed or released.
- *        Every time button1 is pressed, timer1 is toggled, which indirectly
- *        toggles the LED (since timer1 is responsible for toggling led1).
- *        Pin change interrupts are disabled for 300 ms on the button's I/O port
- *        to reduce the effects of contact bounces.
- ********************************************************************************/
-void ButtonCallback(void) {
-    button1.DisableInterruptsOnIoPort();
-    timer0.Start();
-	if (button1.Read()) {
-		PredictTemp();
-		timer1.Restart();
-	}
-}
-
-/********************************************************************************
- * @brief Enabled pin change interrupts on the button's I/O port 300 ms after
- *        press or release to reduce the effects of contact bounces.
- ********************************************************************************/
-void Timer0Callback(void) {
-    if (timer0.Elapsed()) {
-        timer0.Stop();
-	    button1.EnableInterruptsOnIoPort();
-	}
-}
-
-/********************************************************************************
- * @brief Toggles PreditctTemp when timer1 elapsed, which is every 100 ms 
- *        when enabled.
- ********************************************************************************/
-void Timer1Callback(void) {
-    if (timer1.Elapsed()) {
-        PredictTemp();   
-    }
-}
-
-/********************************************************************************
- * @brief Sets callback routines, enabled pin change interrupt on button1 and
- *        enables the watchdog timer in system reset mode.
- ********************************************************************************/
-inline void Setup(void) {
-	const Vector<double> inputs{{0.0, 1.0, 2.0, 3.0, 4.0}};
-	const Vector<double> outputs{{-50.0, 50.0, 150.0, 250.0, 350.0}};
-	model.LoadTrainingData(inputs, outputs);
-	model.Train(1000);
-	
-	serial::Init();
-	PredictTemp();
-	timer1.Start();
-	
-	button1.SetCallbackRoutine(ButtonCallback);
-	timer0.SetCallback(Timer0Callback);
-    timer1.SetCallback(Timer1Callback);
-
-	button1.EnableInterrupt();
-	watchdog::Init(watchdog::Timeout::k1024ms);
-	watchdog::EnableSystemReset();
-}
-
-} /* namespace */
-
-/********************************************************************************
- * @brief Perform a setup of the system, then running the program as long as
- *        voltage is supplied. The hardware is interrupt controlled, hence the
- *        while loop is almost empty. If the program gets stuck anywhere, the
- *        watchdog timer won't be reset in time and the program will then restart.
- ********************************************************************************/
-int main(void)
-{
-    Setup();
-
-    while (1) 
-    {
-	    watchdog::Reset();
-    }
-	return 0;
+/********************************************************************************
+ * @brief Demonstration of GPIO device drivers in C++.
+ ********************************************************************************/
+#include <drivers.hpp> 
+#include <lin_reg.hpp>
+
+/********************************************************************************
+ * @brief Model trained on the host by host/model_codegen, if generated. The
+ *        model is then used as is instead of being trained on the device.
+ ********************************************************************************/
+#if __has_include(<generated_model.hpp>)
+#include <generated_model.hpp>
+#define GENERATED_MODEL
+#endif
+
+using namespace yrgo::driver;
+using namespace yrgo::container;
+
+/********************************************************************************
+ * @brief Devices and models used in the embedded system.
+ *
+ * @param model
+ *        Linear regression model for predicting the temperature.
+ * @param button1
+ *        Button used to toggle the LED between blinking and being disabled.
+ * @param timer0
+ *        Timer used to reduced the effect of contact bounces when pressing
+ *        the button.
+ * @param timer1
+ *        Timer used to predict temp every 60 seconds.
+ * @param timer2
+ *        Timer used to run the watchdog task supervisor every 16 ms.
+ ********************************************************************************/
+static yrgo::LinReg model{};
+static GPIO tmp1{2, GPIO::Direction::kInput};
+static GPIO button1{13, GPIO::Direction::kInputPullup};
+static Timer timer0{Timer::Circuit::k0, 300};
+static Timer timer1{Timer::Circuit::k1, 60000};
+static Timer timer2{Timer::Circuit::k2, 16};
+
+/********************************************************************************
+ * @brief Location and layout version of the model parameters stored in EEPROM.
+ *        The version must be increased if the training data is changed, so
+ *        that the model is retrained instead of restored.
+ ********************************************************************************/
+static constexpr uint16_t kModelAddress{0};
+static constexpr uint8_t kModelVersion{1};
+
+/********************************************************************************
+ * @brief Training telemetry printed after the model has been trained, here
+ *        every 125th of the 1000 epochs. All timers are in use, so no tick 
+ *        function is set and the output holds no ticks column.
+ ********************************************************************************/
+static constexpr size_t kTelemetryRecords{8};
+static constexpr uint32_t kTelemetryInterval{125};
+
+/********************************************************************************
+ * @brief Tasks supervised by the watchdog timer.
+ *
+ * @param main_task
+ *        The main loop, which must check in at least every 500 ms.
+ * @param predict_task
+ *        The periodic prediction, which must run at least every 65 seconds.
+ ********************************************************************************/
+static uint8_t main_task{watchdog::kNoTask};
+static uint8_t predict_task{watchdog::kNoTask};
+static constexpr uint16_t kSupervisePeriod_ms{16};
+
+namespace {
+
+/*********************************************************************************
+ * @brief Predicts and prints temperature based on input voltage.
+ *
+ * This function reads an analog voltage signal from channel 2 using the adc::Read function,
+ * scales it to a voltage value between 0 and 5, and then uses a predictive model (presumably stored
+ * in the 'model' variable) to estimate the temperature corresponding to the input voltage.
+ * The predicted temperature is then rounded using the utils::Round function and printed to the serial output.
+ **********************************************************************************/
+void PredictTemp(void) {
+	const double uin = adc::Read(2) / (double)adc::kMaxVal * 5.0;
+	const auto temp = model.Predict(uin);
+	serial::Printf("Temp: %d\n", utils::Round(temp));
+}
+
+/********************************************************************************
+ * @brief Callback routine called when button1 is pressed or released.
+ *        Every time button1 is pressed, timer1 is toggled, which indirectly
+ *        toggles the LED (since timer1 is responsible for toggling led1).
+ *        Pin change interrupts are disabled for 300 ms on the button's I/O port
+ *        to reduce the effects of contact bounces.
+ ********************************************************************************/
+void ButtonCallback(void) {
+    button1.DisableInterruptsOnIoPort();
+    timer0.Start();
+	if (button1.Read()) {
+		PredictTemp();
+		timer1.Restart();
+	}
+}
+
+/********************************************************************************
+ * @brief Enabled pin change interrupts on the button's I/O port 300 ms after
+ *        press or release to reduce the effects of contact bounces.
+ ********************************************************************************/
+void Timer0Callback(void) {
+    if (timer0.Elapsed()) {
+        timer0.Stop();
+	    button1.EnableInterruptsOnIoPort();
+	}
+}
+
+/********************************************************************************
+ * @brief Toggles PreditctTemp when timer1 elapsed, which is every 100 ms 
+ *        when enabled.
+ ********************************************************************************/
+void Timer1Callback(void) {
+    if (timer1.Elapsed()) {
+        diagnostics::Checkpoint(predict_task, 0);
+        PredictTemp();   
+        diagnostics::Checkpoint(predict_task, 1);
+        watchdog::CheckIn(predict_task);
+    }
+}
+
+/********************************************************************************
+ * @brief Runs the watchdog task supervisor every 16 ms. The watchdog timer is
+ *        only reset if every supervised task has checked in before its deadline.
+ ********************************************************************************/
+void Timer2Callback(void) {
+    if (timer2.Elapsed()) {
+        watchdog::Supervise(kSupervisePeriod_ms);
+    }
+}
+
+/********************************************************************************
+ * @brief Uses the model generated on the host if present. Else restores the 
+ *        model parameters from EEPROM or trains the model, prints the training
+ *        telemetry and stores the parameters if no valid parameters are found.
+ *        Then sets callback routines, enabled pin change
+ *        interrupt on button1, registers the supervised tasks and enables the
+ *        watchdog timer in system reset mode.
+ ********************************************************************************/
+inline void Setup(void) {
+	serial::Init();
+	diagnostics::Print();
+	
+#ifdef GENERATED_MODEL
+	model.SetParameters(yrgo::generated::kTempModel);
+#else
+	yrgo::LinReg::Parameters parameters{};
+	if (eeprom::ReadRecord(kModelAddress, parameters, kModelVersion)) {
+	    model.SetParameters(parameters);
+	} else {
+	    const Vector<double> inputs{{0.0, 1.0, 2.0, 3.0, 4.0}};
+	    const Vector<double> outputs{{-50.0, 50.0, 150.0, 250.0, 350.0}};
+	    yrgo::TrainingTelemetry telemetry{kTelemetryRecords, kTelemetryInterval};
+	    model.LoadTrainingData(inputs, outputs);
+	    model.SetTelemetry(&telemetry);
+	    model.Train(1000);
+	    model.SetTelemetry();
+	    telemetry.WriteCsv([](const char* s) { serial::Print(s); });
+	    eeprom::WriteRecord(kModelAddress, model.GetParameters(), kModelVersion);
+	}
+#endif
+	
+	PredictTemp();
+	timer1.Start();
+	
+	button1.SetCallbackRoutine(ButtonCallback);
+	timer0.SetCallback(Timer0Callback);
+    timer1.SetCallback(Timer1Callback);
+    timer2.SetCallback(Timer2Callback);
+
+	button1.EnableInterrupt();
+	watchdog::RegisterTask(500, main_task);
+	watchdog::RegisterTask(65000, predict_task);
+	watchdog::Init(watchdog::Timeout::k1024ms);
+	watchdog::EnableSystemReset();
+	timer2.Start();
+}
+
+} /* namespace */
+
+/********************************************************************************
+ * @brief Perform a setup of the system, then running the program as long as
+ *        voltage is supplied. The hardware is interrupt controlled, hence the
+ *        while loop is almost empty. The main loop only checks in with the
+ *        watchdog task supervisor. If the main loop or any other supervised task
+ *        gets stuck, the watchdog timer won't be reset in time and the program
+ *        will then restart.
+ ********************************************************************************/
+int main(void)
+{
+    Setup();
+
+    while (1) 
+    {
+	    watchdog::CheckIn(main_task);
+    }
+	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,486 @@
+/********************************************************************************
+ * @brief Implementation of dynamic matrices of any arithmetic type, with
+ *        cache-blocked linear algebra kernels.
+ ********************************************************************************/
+#pragma once
+
+#include <container.hpp>
+#include <math.h>
+
+namespace yrgo {
+namespace container {
+
+/********************************************************************************
+ * @brief The alignment of each matrix row in bytes. On the host, rows are
+ *        aligned to the width of an AVX register, so vectorized kernels can use
+ *        aligned loads. The ATmega328P has no vector unit, so no alignment or
+ *        padding is used there.
+ ********************************************************************************/
+#ifdef __AVR__
+constexpr size_t kRowAlignment{1};
+#else
+constexpr size_t kRowAlignment{32};
+#endif
+
+/********************************************************************************
+ * @brief Class for implementation of dynamic matrices.
+ *
+ *        The elements are stored row-major in one contiguous memory block. Each
+ *        row is padded with zeros to a multiple of kRowAlignment bytes, so every
+ *        row starts at an aligned address. The distance between two rows in
+ *        elements is given by Stride.
+ ********************************************************************************/
+template <typename T>
+class Matrix {
+  public:
+
+    /********************************************************************************
+     * @brief The number of elements per row alignment, i.e. per vector register.
+     ********************************************************************************/
+    static constexpr size_t kLanes{kRowAlignment / sizeof(T) > 0 ? kRowAlignment / sizeof(T) : 1};
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty matrix.
+     ********************************************************************************/
+    Matrix(void) noexcept = default;
+
+    /********************************************************************************
+     * @brief Creates matrix of specified size with all elements set to zero.
+     *
+     * @param rows
+     *        The number of rows.
+     * @param cols
+     *        The number of columns.
+     ********************************************************************************/
+    Matrix(const size_t rows, const size_t cols) noexcept {
+        Resize(rows, cols);
+    }
+
+    /********************************************************************************
+     * @brief Creates matrix as a copy of referenced source.
+     *
+     * @param source
+     *        Reference to matrix whose content is copied to the new matrix.
+     ********************************************************************************/
+    Matrix(const Matrix& source) noexcept {
+        Copy(source);
+    }
+
+    /********************************************************************************
+     * @brief Move constructor, moves content from referenced source to assigned
+     *        matrix. The source is emptied after the move operation is performed.
+     *
+     * @param source
+     *        Reference to matrix whose content is moved to assigned matrix.
+     ********************************************************************************/
+    Matrix(Matrix&& source) noexcept {
+        block_ = source.block_;
+        data_ = source.data_;
+        rows_ = source.rows_;
+        cols_ = source.cols_;
+        stride_ = source.stride_;
+        source.block_ = source.data_ = nullptr;
+        source.rows_ = source.cols_ = source.stride_ = 0;
+    }
+
+    /********************************************************************************
+     * @brief Destructor, clears memory allocated for referenced matrix.
+     ********************************************************************************/
+    ~Matrix(void) noexcept { Clear(); }
+
+    /********************************************************************************
+     * @brief Assignment operator, copies the content of referenced matrix to
+     *        assigned matrix. Previous values are cleared before copying.
+     *
+     * @param source
+     *        Reference to matrix containing the values to copy.
+     ********************************************************************************/
+    void operator=(const Matrix& source) noexcept {
+        if (&source == this) return;
+        Clear();
+        Copy(source);
+    }
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified row and column.
+     *
+     * @param row
+     *        The row of the element.
+     * @param col
+     *        The column of the element.
+     * @return
+     *        A reference to the element.
+     ********************************************************************************/
+    T& operator()(const size_t row, const size_t col) noexcept {
+        return data_[row * stride_ + col];
+    }
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified row and column.
+     *
+     * @param row
+     *        The row of the element.
+     * @param col
+     *        The column of the element.
+     * @return
+     *        A reference to the element.
+     ********************************************************************************/
+    const T& operator()(const size_t row, const size_t col) const noexcept {
+        return data_[row * stride_ + col];
+    }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the first element of specified row.
+     ********************************************************************************/
+    T* Row(const size_t row) noexcept { return data_ + row * stride_; }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the first element of specified row.
+     ********************************************************************************/
+    const T* Row(const size_t row) const noexcept { return data_ + row * stride_; }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the first element of the matrix.
+     ********************************************************************************/
+    T* Data(void) noexcept { return data_; }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the first element of the matrix.
+     ********************************************************************************/
+    const T* Data(void) const noexcept { return data_; }
+
+    /********************************************************************************
+     * @brief Returns the number of rows of referenced matrix.
+     ********************************************************************************/
+    size_t Rows(void) const noexcept { return rows_; }
+
+    /********************************************************************************
+     * @brief Returns the number of columns of referenced matrix.
+     ********************************************************************************/
+    size_t Cols(void) const noexcept { return cols_; }
+
+    /********************************************************************************
+     * @brief Returns the distance between two rows in number of elements, i.e.
+     *        the number of columns rounded up to a multiple of kLanes.
+     ********************************************************************************/
+    size_t Stride(void) const noexcept { return stride_; }
+
+    /********************************************************************************
+     * @brief Checks if referenced matrix is empty.
+     ********************************************************************************/
+    bool Empty(void) const noexcept { return rows_ == 0 || cols_ == 0; }
+
+    /********************************************************************************
+     * @brief Clears content of referenced matrix by deallocating memory on the
+     *        heap. All member variables are reset to starting values.
+     ********************************************************************************/
+    void Clear(void) noexcept {
+        detail::Delete<T>(block_);
+        data_ = nullptr;
+        rows_ = cols_ = stride_ = 0;
+    }
+
+    /********************************************************************************
+     * @brief Resizes referenced matrix to specified size. All elements (and the
+     *        padding) are set to zero, the previous content isn't kept. The
+     *        matrix is unchanged if the memory allocation fails.
+     *
+     * @param rows
+     *        The new number of rows.
+     * @param cols
+     *        The new number of columns.
+     * @return
+     *        True if the matrix was resized, else false.
+     ********************************************************************************/
+    bool Resize(const size_t rows, const size_t cols) noexcept {
+        const auto stride{(cols + kLanes - 1) / kLanes * kLanes};
+        const auto size{rows * stride + kLanes - 1};
+        auto block{detail::New<T>(size)};
+        if (block == nullptr) return false;
+        Clear();
+        block_ = block;
+        data_ = Align(block);
+        rows_ = rows;
+        cols_ = cols;
+        stride_ = stride;
+        for (size_t i{}; i < rows_ * stride_; ++i) {
+            data_[i] = T{};
+        }
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Sets every element of referenced matrix to specified value. The
+     *        padding is kept zero.
+     *
+     * @param value
+     *        The value to assign.
+     ********************************************************************************/
+    void Fill(const T& value) noexcept {
+        for (size_t i{}; i < rows_; ++i) {
+            auto row{Row(i)};
+            for (size_t j{}; j < cols_; ++j) {
+                row[j] = value;
+            }
+        }
+    }
+
+  private:
+    T* block_{nullptr}; /* Pointer to the allocated memory block. */
+    T* data_{nullptr};  /* Pointer to the first (aligned) element. */
+    size_t rows_{};     /* The number of rows. */
+    size_t cols_{};     /* The number of columns. */
+    size_t stride_{};   /* The distance between two rows in elements. */
+
+    /********************************************************************************
+     * @brief Returns the first address in specified block aligned to
+     *        kRowAlignment bytes. The block holds kLanes - 1 extra elements, so
+     *        the aligned matrix always fits.
+     ********************************************************************************/
+    static T* Align(T* block) noexcept {
+        const auto address{reinterpret_cast<size_t>(block)};
+        const auto offset{address % kRowAlignment};
+        return offset == 0 ? block : reinterpret_cast<T*>(address + kRowAlignment - offset);
+    }
+
+    /********************************************************************************
+     * @brief Copies the size and content of referenced source.
+     *
+     * @return
+     *        True if the content was copied, else false.
+     ********************************************************************************/
+    bool Copy(const Matrix& source) noexcept {
+        if (!Resize(source.rows_, source.cols_)) return false;
+        for (size_t i{}; i < rows_ * stride_; ++i) {
+            data_[i] = source.data_[i];
+        }
+        return true;
+    }
+};
+
+namespace detail {
+
+/********************************************************************************
+ * @brief The number of elements per block of the cache-blocked kernels. Three
+ *        blocks of 64 x 64 doubles fit in a 128 kB L2 cache, while each block
+ *        row fits in a few cache lines.
+ ********************************************************************************/
+constexpr size_t kBlockSize{64};
+
+/********************************************************************************
+ * @brief Calculates the dot product of specified arrays. The products are
+ *        summed in kLanes independent accumulators, which the compiler maps to
+ *        one vector register without reordering any floating-point sums.
+ ********************************************************************************/
+template <typename T>
+inline T Dot(const T* a, const T* b, const size_t size) noexcept {
+    constexpr auto kLanes{Matrix<T>::kLanes};
+    T sums[kLanes]{};
+    size_t i{};
+    for (; i + kLanes <= size; i += kLanes) {
+        for (size_t j{}; j < kLanes; ++j) {
+            sums[j] += a[i + j] * b[i + j];
+        }
+    }
+    for (; i < size; ++i) {
+        sums[0] += a[i] * b[i];
+    }
+    T sum{};
+    for (size_t j{}; j < kLanes; ++j) {
+        sum += sums[j];
+    }
+    return sum;
+}
+
+/********************************************************************************
+ * @brief Adds specified array multiplied by specified factor to the target
+ *        array, i.e. y = y + a * x.
+ ********************************************************************************/
+template <typename T>
+inline void Axpy(const T factor, const T* x, T* y, const size_t size) noexcept {
+    for (size_t i{}; i < size; ++i) {
+        y[i] += factor * x[i];
+    }
+}
+
+/********************************************************************************
+ * @brief Returns the smallest of specified values.
+ ********************************************************************************/
+inline size_t Min(const size_t a, const size_t b) noexcept { return a < b ? a : b; }
+
+} /* namespace detail */
+
+/********************************************************************************
+ * @brief Multiplies specified matrix with specified vector, i.e. y = A * x.
+ *        The columns are processed in blocks, so each block of x stays in the
+ *        cache while it's multiplied with every row.
+ *
+ * @param a
+ *        Reference to the matrix (m x n).
+ * @param x
+ *        Pointer to array holding the vector (n elements).
+ * @param y
+ *        Pointer to array to store the result in (m elements).
+ ********************************************************************************/
+template <typename T>
+void Multiply(const Matrix<T>& a, const T* x, T* y) noexcept {
+    for (size_t i{}; i < a.Rows(); ++i) {
+        y[i] = T{};
+    }
+    for (size_t j{}; j < a.Cols(); j += detail::kBlockSize) {
+        const auto size{detail::Min(detail::kBlockSize, a.Cols() - j)};
+        for (size_t i{}; i < a.Rows(); ++i) {
+            y[i] += detail::Dot(a.Row(i) + j, x + j, size);
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Multiplies the transpose of specified matrix with specified vector,
+ *        i.e. y = A^T * x. Each row is added to y multiplied by its element of
+ *        x, where the columns are processed in blocks, so each block of y stays
+ *        in the cache while every row is added to it.
+ *
+ * @param a
+ *        Reference to the matrix (m x n).
+ * @param x
+ *        Pointer to array holding the vector (m elements).
+ * @param y
+ *        Pointer to array to store the result in (n elements).
+ ********************************************************************************/
+template <typename T>
+void MultiplyTransposed(const Matrix<T>& a, const T* x, T* y) noexcept {
+    for (size_t j{}; j < a.Cols(); ++j) {
+        y[j] = T{};
+    }
+    for (size_t j{}; j < a.Cols(); j += detail::kBlockSize) {
+        const auto size{detail::Min(detail::kBlockSize, a.Cols() - j)};
+        for (size_t i{}; i < a.Rows(); ++i) {
+            detail::Axpy(x[i], a.Row(i) + j, y + j, size);
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Multiplies specified matrices, i.e. C = A * B. The matrices are
+ *        processed in square blocks, so the blocks of A, B and C in use stay in
+ *        the cache. Within a block, each element of A multiplies a contiguous
+ *        part of a row of B into a row of C, which vectorizes.
+ *
+ * @param a
+ *        Reference to the left matrix (m x k).
+ * @param b
+ *        Reference to the right matrix (k x n).
+ * @param c
+ *        Reference to the matrix to store the result in, resized to m x n.
+ * @return
+ *        True if the matrices were multiplied, false if the sizes don't match or
+ *        the memory couldn't be allocated.
+ ********************************************************************************/
+template <typename T>
+bool Multiply(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c) noexcept {
+    if (a.Cols() != b.Rows() || &c == &a || &c == &b || !c.Resize(a.Rows(), b.Cols())) {
+        return false;
+    }
+    constexpr auto kBlock{detail::kBlockSize};
+    for (size_t i0{}; i0 < a.Rows(); i0 += kBlock) {
+        const auto i1{detail::Min(i0 + kBlock, a.Rows())};
+        for (size_t p0{}; p0 < a.Cols(); p0 += kBlock) {
+            const auto p1{detail::Min(p0 + kBlock, a.Cols())};
+            for (size_t j0{}; j0 < b.Cols(); j0 += kBlock) {
+                const auto size{detail::Min(kBlock, b.Cols() - j0)};
+                for (auto i{i0}; i < i1; ++i) {
+                    for (auto p{p0}; p < p1; ++p) {
+                        detail::Axpy(a(i, p), b.Row(p) + j0, c.Row(i) + j0, size);
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @brief Multiplies specified matrix with the transpose of the other, i.e.
+ *        C = A * B^T, where each element is the dot product of a row of A and a
+ *        row of B. Both rows are contiguous, so no transpose is made. The rows
+ *        are processed in blocks, so the blocks of A and B in use stay in the
+ *        cache. With B = A, this gives the Gram matrix of the rows of A.
+ *
+ * @param a
+ *        Reference to the left matrix (m x k).
+ * @param b
+ *        Reference to the right matrix (n x k).
+ * @param c
+ *        Reference to the matrix to store the result in, resized to m x n.
+ * @return
+ *        True if the matrices were multiplied, false if the sizes don't match or
+ *        the memory couldn't be allocated.
+ ********************************************************************************/
+template <typename T>
+bool MultiplyTransposed(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c) noexcept {
+    if (a.Cols() != b.Cols() || &c == &a || &c == &b || !c.Resize(a.Rows(), b.Rows())) {
+        return false;
+    }
+    constexpr auto kBlock{detail::kBlockSize};
+    for (size_t p0{}; p0 < a.Cols(); p0 += 4 * kBlock) {
+        const auto size{detail::Min(4 * kBlock, a.Cols() - p0)};
+        for (size_t i0{}; i0 < a.Rows(); i0 += kBlock) {
+            const auto i1{detail::Min(i0 + kBlock, a.Rows())};
+            for (size_t j0{}; j0 < b.Rows(); j0 += kBlock) {
+                const auto j1{detail::Min(j0 + kBlock, b.Rows())};
+                for (auto i{i0}; i < i1; ++i) {
+                    for (auto j{j0}; j < j1; ++j) {
+                        c(i, j) += detail::Dot(a.Row(i) + p0, b.Row(j) + p0, size);
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @brief Solves the equation system A * x = b via Cholesky decomposition
+ *        A = L * L^T, where A is symmetric positive definite (e.g. the normal
+ *        equations of a least squares problem).
+ *
+ *        Each element of L is calculated from the dot product of two row
+ *        prefixes of L, which are contiguous, and the back substitution adds
+ *        contiguous rows of L, so every inner loop runs over contiguous memory.
+ *
+ * @param a
+ *        Reference to the matrix (n x n). Its lower triangle is overwritten by L.
+ * @param b
+ *        Pointer to array holding the right-hand side (n elements), which is
+ *        overwritten by the solution x.
+ * @return
+ *        True if the system was solved, false if the matrix isn't square or
+ *        isn't positive definite.
+ ********************************************************************************/
+template <typename T>
+bool CholeskySolve(Matrix<T>& a, T* b) noexcept {
+    const auto n{a.Rows()};
+    if (a.Cols() != n) return false;
+    for (size_t j{}; j < n; ++j) {
+        const auto row_j{a.Row(j)};
+        const auto diagonal{row_j[j] - detail::Dot(row_j, row_j, j)};
+        if (!(diagonal > 0)) return false;
+        row_j[j] = sqrt(diagonal);
+        for (auto i{j + 1}; i < n; ++i) {
+            const auto row_i{a.Row(i)};
+            row_i[j] = (row_i[j] - detail::Dot(row_i, row_j, j)) / row_j[j];
+        }
+    }
+    for (size_t i{}; i < n; ++i) {
+        b[i] = (b[i] - detail::Dot(a.Row(i), b, i)) / a(i, i);
+    }
+    for (auto i{n}; i-- > 0;) {
+        b[i] /= a(i, i);
+        detail::Axpy(-b[i], a.Row(i), b, i);
+    }
+    return true;
+}
+
+} /* namespace container */
+} /* namespace yrgo */
\ No newline at end of file
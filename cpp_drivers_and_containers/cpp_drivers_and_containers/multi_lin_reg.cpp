@@ -0,0 +1,265 @@
+/********************************************************************************
+ * @brief Implementation details for the MultiLinReg class.
+ ********************************************************************************/
+#include <multi_lin_reg.hpp>
+#include <math.h>
+
+namespace yrgo {
+
+namespace {
+
+/********************************************************************************
+ * @brief Soft-thresholding operator used by lasso regression, which shrinks
+ *        specified value towards zero by the specified threshold.
+ ********************************************************************************/
+inline double SoftThreshold(const double value, const double threshold) {
+    if (value > threshold) return value - threshold;
+    if (value < -threshold) return value + threshold;
+    return 0.0;
+}
+
+/********************************************************************************
+ * @brief Creates vector of specified size with all elements set to zero.
+ ********************************************************************************/
+inline container::Vector<double> Zeros(const size_t size) {
+    container::Vector<double> vector{size};
+    for (auto& i : vector) {
+        i = 0.0;
+    }
+    return vector;
+}
+
+} /* namespace */
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The prediction is the sum of each input value multiplied by the
+ *           weight of its feature, plus the bias.
+ ********************************************************************************/
+double MultiLinReg::Predict(const container::Vector<double>& input) const {
+    auto prediction{bias_};
+    for (size_t j{}; j < num_features_ && j < input.Size(); ++j) {
+        prediction += weights_[j] * input[j];
+    }
+    return prediction;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The training data is only accepted if the input data holds exactly
+ *           num_features values per reference value.
+ *        2. The training data is copied and the train order vector initialized.
+ *        3. The weights are reset if the number of features has changed, else
+ *           they are kept as starting point for the training.
+ ********************************************************************************/
+bool MultiLinReg::LoadTrainingData(const container::Vector<double>& train_in,
+                                   const size_t num_features,
+                                   const container::Vector<double>& train_out) {
+    if (num_features == 0 || train_in.Size() != num_features * train_out.Size()) return false;
+    train_in_ = train_in;
+    train_out_ = train_out;
+    if (train_in_.Size() != train_in.Size() || train_out_.Size() != train_out.Size() ||
+        !train_order_.Resize(train_out.Size())) {
+        return false;
+    }
+    for (size_t i{}; i < train_order_.Size(); ++i) {
+        train_order_[i] = i;
+    }
+    if (num_features != num_features_) {
+        weights_ = Zeros(num_features);
+        bias_ = 0.0;
+        num_features_ = num_features;
+    }
+    return weights_.Size() == num_features;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The training order is randomized before each epoch.
+ *        2. For each training set, the error is calculated and the bias and
+ *           each weight are adjusted according to the error, the learning rate
+ *           and (for the weights) the input value of the feature.
+ ********************************************************************************/
+void MultiLinReg::Train(const size_t num_epochs, const double learning_rate) {
+    const auto num_sets{NumSets()};
+    for (size_t i{}; i < num_epochs; ++i) {
+        RandomizeTrainingOrder();
+        for (const auto& j : train_order_) {
+            const auto error{train_out_[j] - Predict(train_in_.Data(), num_sets, j)};
+            bias_ += error * learning_rate;
+            for (size_t k{}; k < num_features_; ++k) {
+                weights_[k] += error * learning_rate * train_in_[k * num_sets + j];
+            }
+        }
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The features and references are centered around their means, so
+ *           the bias can be calculated afterwards instead of being optimized.
+ *        2. The covariances between all features (the Gram matrix G) and between
+ *           each feature and the references (c) are calculated once via dot
+ *           products over the contiguous columns. Each pass then only costs
+ *           O(features^2) regardless of the number of training sets.
+ *        3. Each pass minimizes the cost with respect to one weight at a time,
+ *           keeping the others fixed, which has the closed-form solution
+ *
+ *                  rho = c_j - sum(G_jk * k_k) + G_jj * k_j,
+ *                  k_j = rho / (G_jj + lambda)            (ridge),
+ *                  k_j = S(rho, lambda) / G_jj            (lasso),
+ *
+ *           where S is soft-thresholding. The current weights are used as
+ *           starting point (warm start).
+ *        4. The passes are repeated until the largest weight change is below
+ *           the tolerance or the maximum number of passes is reached.
+ *        5. The bias is finally set so that the model passes through the means.
+ ********************************************************************************/
+size_t MultiLinReg::Fit(const Penalty penalty, const double lambda,
+                        const size_t max_iterations, const double tolerance) {
+    const auto num_sets{NumSets()};
+    if (num_sets == 0 || num_features_ == 0) return 0;
+
+    auto means{Zeros(num_features_)};
+    auto covariances{Zeros(num_features_)};
+    auto gram{Zeros(num_features_ * num_features_)};
+    double y_mean{};
+
+    for (size_t i{}; i < num_sets; ++i) {
+        y_mean += train_out_[i];
+    }
+    y_mean /= num_sets;
+
+    for (size_t j{}; j < num_features_; ++j) {
+        const auto column{train_in_.Data() + j * num_sets};
+        double sum{};
+        for (size_t i{}; i < num_sets; ++i) {
+            sum += column[i];
+        }
+        means[j] = sum / num_sets;
+    }
+
+    for (size_t j{}; j < num_features_; ++j) {
+        const auto column_j{train_in_.Data() + j * num_sets};
+        double sum{};
+        for (size_t i{}; i < num_sets; ++i) {
+            sum += (column_j[i] - means[j]) * (train_out_[i] - y_mean);
+        }
+        covariances[j] = sum / num_sets;
+        for (size_t k{j}; k < num_features_; ++k) {
+            const auto column_k{train_in_.Data() + k * num_sets};
+            double product{};
+            for (size_t i{}; i < num_sets; ++i) {
+                product += (column_j[i] - means[j]) * (column_k[i] - means[k]);
+            }
+            gram[j * num_features_ + k] = gram[k * num_features_ + j] = product / num_sets;
+        }
+    }
+
+    size_t iteration{};
+    while (iteration < max_iterations) {
+        ++iteration;
+        double max_change{};
+        for (size_t j{}; j < num_features_; ++j) {
+            const auto row{gram.Data() + j * num_features_};
+            auto rho{covariances[j]};
+            for (size_t k{}; k < num_features_; ++k) {
+                rho -= row[k] * weights_[k];
+            }
+            rho += row[j] * weights_[j];
+
+            double weight{};
+            if (row[j] > 0) {
+                weight = penalty == Penalty::kLasso ? SoftThreshold(rho, lambda) / row[j]
+                                                    : rho / (row[j] + lambda);
+            }
+            const auto change{fabs(weight - weights_[j])};
+            if (change > max_change) max_change = change;
+            weights_[j] = weight;
+        }
+        if (max_change < tolerance) break;
+    }
+
+    bias_ = y_mean;
+    for (size_t j{}; j < num_features_; ++j) {
+        bias_ -= means[j] * weights_[j];
+    }
+    return iteration;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The model is fitted for each lambda in the specified order, where
+ *           each fit starts from the weights of the previous one.
+ *        2. The validation error is calculated after each fit and the weights
+ *           and bias giving the lowest error are saved.
+ *        3. The saved weights and bias are restored at the end.
+ ********************************************************************************/
+double MultiLinReg::FitPath(const Penalty penalty, const container::Vector<double>& lambdas,
+                            const container::Vector<double>& validation_in,
+                            const container::Vector<double>& validation_out) {
+    double best_lambda{}, best_error{}, best_bias{bias_};
+    container::Vector<double> best_weights{weights_};
+    bool first{true};
+
+    for (const auto& lambda : lambdas) {
+        Fit(penalty, lambda);
+        const auto error{MeanSquaredError(validation_in, validation_out)};
+        if (first || error < best_error) {
+            best_lambda = lambda;
+            best_error = error;
+            best_weights = weights_;
+            best_bias = bias_;
+            first = false;
+        }
+    }
+    weights_ = best_weights;
+    bias_ = best_bias;
+    return best_lambda;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The squared error of each set is summed and divided by the number
+ *           of sets. No error is calculated if the data sizes don't match.
+ ********************************************************************************/
+double MultiLinReg::MeanSquaredError(const container::Vector<double>& input,
+                                     const container::Vector<double>& reference) const {
+    const auto num_sets{reference.Size()};
+    if (num_sets == 0 || input.Size() != num_sets * num_features_) return 0.0;
+    double sum{};
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto error{reference[i] - Predict(input.Data(), num_sets, i)};
+        sum += error * error;
+    }
+    return sum / num_sets;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The value of each feature is fetched from its column, where the
+ *           columns are num_sets values apart.
+ ********************************************************************************/
+double MultiLinReg::Predict(const double* input, const size_t num_sets, const size_t index) const {
+    auto prediction{bias_};
+    for (size_t j{}; j < num_features_; ++j) {
+        prediction += weights_[j] * input[j * num_sets + index];
+    }
+    return prediction;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each index of the train order vector is swapped with a random index
+ *           from the generator of the model.
+ ********************************************************************************/
+void MultiLinReg::RandomizeTrainingOrder(void) {
+    for (size_t i{}; i < train_order_.Size(); ++i) {
+        const auto r{random_.Next(train_order_.Size())};
+        const auto temp{train_order_[i]};
+        train_order_[i] = train_order_[r];
+        train_order_[r] = temp;
+    }
+}
+
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,212 @@
+/********************************************************************************
+ * @brief Library for implementing multiple linear regression models in C++,
+ *        i.e. models with several input features.
+ ********************************************************************************/
+#pragma once
+
+#include <vector.hpp>
+#include <stdint.h>
+#include <stdlib.h>
+#include <xorshift.hpp>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing multiple linear regression models, where the
+ *        prediction is calculated as
+ *
+ *                       y_pred = k1 * x1 + k2 * x2 + ... + kn * xn + m.
+ *
+ *        The training data is stored column-major, i.e. all values of the first
+ *        feature followed by all values of the second feature and so on. Each
+ *        feature is then contiguous in memory, which makes the per-feature loops
+ *        of coordinate descent vectorizable.
+ ********************************************************************************/
+class MultiLinReg {
+  public:
+
+    /********************************************************************************
+     * @brief Enumeration class for selecting regularization.
+     *
+     * @param kRidge
+     *        L2 regularization, shrinks the weights of correlated features.
+     * @param kLasso
+     *        L1 regularization, sets the weights of superfluous features to zero.
+     ********************************************************************************/
+    enum class Penalty { kRidge, kLasso };
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty regression model.
+     ********************************************************************************/
+    MultiLinReg(void) = default;
+
+    /********************************************************************************
+     * @brief Makes a prediction with the specified input values.
+     *
+     * @param input
+     *        Reference to vector containing one value per feature.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    double Predict(const container::Vector<double>& input) const;
+
+    /********************************************************************************
+     * @brief Provides the number of features of the model.
+     *
+     * @return
+     *        The number of features.
+     ********************************************************************************/
+    size_t NumFeatures(void) const { return num_features_; }
+
+    /********************************************************************************
+     * @brief Provides the weights of the model, one per feature.
+     *
+     * @return
+     *        Reference to vector containing the weights.
+     ********************************************************************************/
+    const container::Vector<double>& Weights(void) const { return weights_; }
+
+    /********************************************************************************
+     * @brief Provides the bias of the model.
+     *
+     * @return
+     *        The bias (m-value).
+     ********************************************************************************/
+    double Bias(void) const { return bias_; }
+
+    /********************************************************************************
+     * @brief Loads training data from referenced vectors. The weights are reset
+     *        if the number of features is changed.
+     *
+     * @param train_in
+     *        Reference to vector containing input data stored column-major,
+     *        i.e. num_features columns of train_out.Size() values each.
+     * @param num_features
+     *        The number of features.
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref).
+     * @return
+     *        True if the training data was loaded, false if the sizes of the
+     *        vectors don't match or the memory allocation failed.
+     ********************************************************************************/
+    bool LoadTrainingData(const container::Vector<double>& train_in, const size_t num_features,
+                          const container::Vector<double>& train_out);
+
+    /********************************************************************************
+     * @brief Trains regression model via stochastic gradient descent.
+     *
+     * @param num_epochs
+     *        The number of epochs (turns) to train.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors (default = 0.01).
+     ********************************************************************************/
+    void Train(const size_t num_epochs, const double learning_rate = 0.01);
+
+    /********************************************************************************
+     * @brief Seeds the random generator of the model, which makes the training 
+     *        reproducible. If never called, the generator is seeded from the 
+     *        time the first time it's used.
+     *
+     * @param seed
+     *        The seed to use (0 is replaced by 1).
+     ********************************************************************************/
+    void SetRandomSeed(const uint32_t seed) { random_.Seed(seed); }
+
+    /********************************************************************************
+     * @brief Fits regularized regression model via cyclic coordinate descent,
+     *        which minimizes
+     *
+     *            1 / (2n) * sum((y_ref - y_pred)^2) + lambda * penalty(weights),
+     *
+     *        where penalty is sum(|k|) for lasso and sum(k^2) / 2 for ridge. The
+     *        current weights are used as starting point (warm start), so fitting
+     *        a sequence of decreasing lambdas converges in a few iterations each.
+     *
+     * @param penalty
+     *        The regularization to use.
+     * @param lambda
+     *        The regularization strength (0 = ordinary least squares).
+     * @param max_iterations
+     *        The maximum number of passes over all features (default = 1000).
+     * @param tolerance
+     *        Convergence limit for the largest weight change of a pass
+     *        (default = 1e-6).
+     * @return
+     *        The number of passes performed.
+     ********************************************************************************/
+    size_t Fit(const Penalty penalty, const double lambda, const size_t max_iterations = 1000,
+               const double tolerance = 1e-6);
+
+    /********************************************************************************
+     * @brief Fits the model along a regularization path, i.e. for each specified
+     *        lambda in decreasing order, with the solution of each lambda as warm
+     *        start for the next. The weights giving the lowest mean squared error
+     *        on the validation data are kept.
+     *
+     * @param penalty
+     *        The regularization to use.
+     * @param lambdas
+     *        Reference to vector containing the lambdas to fit, sorted from the
+     *        strongest to the weakest regularization.
+     * @param validation_in
+     *        Reference to vector containing validation input data (column-major).
+     * @param validation_out
+     *        Reference to vector containing validation reference data.
+     * @return
+     *        The lambda giving the lowest validation error.
+     ********************************************************************************/
+    double FitPath(const Penalty penalty, const container::Vector<double>& lambdas,
+                   const container::Vector<double>& validation_in,
+                   const container::Vector<double>& validation_out);
+
+    /********************************************************************************
+     * @brief Calculates the mean squared error of the model on specified data.
+     *
+     * @param input
+     *        Reference to vector containing input data (column-major).
+     * @param reference
+     *        Reference to vector containing reference data (y_ref).
+     * @return
+     *        The mean squared error (0 if no data is specified).
+     ********************************************************************************/
+    double MeanSquaredError(const container::Vector<double>& input,
+                            const container::Vector<double>& reference) const;
+
+  /********************************************************************************
+   * @note The private segment is only visible internally (i.e. in this class).
+   ********************************************************************************/
+  private:
+    container::Vector<double> train_in_{};    /* Input values, column-major. */
+    container::Vector<double> train_out_{};   /* Reference values (y_ref). */
+    container::Vector<size_t> train_order_{}; /* Stores indexes for training sets. */
+    container::Vector<double> weights_{};     /* k-values, one per feature. */
+    double bias_{};                           /* m-value. */
+    size_t num_features_{};                   /* Number of features. */
+    Xorshift32 random_{};                     /* Random generator of the model. */
+
+    /********************************************************************************
+     * @brief Provides the number of stored training sets.
+     ********************************************************************************/
+    size_t NumSets(void) const { return train_out_.Size(); }
+
+    /********************************************************************************
+     * @brief Makes a prediction for a set stored column-major in specified data.
+     *
+     * @param input
+     *        Pointer to the first column of the data.
+     * @param num_sets
+     *        The number of sets (rows) of the data.
+     * @param index
+     *        The index of the set to predict.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    double Predict(const double* input, const size_t num_sets, const size_t index) const;
+
+    /********************************************************************************
+     * @brief Randomizes the training order before each new epoch.
+     ********************************************************************************/
+    void RandomizeTrainingOrder(void);
+};
+
+} /* namespace yrgo */
\ No newline at end of file
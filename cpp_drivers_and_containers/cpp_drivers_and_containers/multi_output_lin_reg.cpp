@@ -0,0 +1,180 @@
+/********************************************************************************
+ * @brief Implementation details for the MultiOutputLinReg class.
+ ********************************************************************************/
+#include <multi_output_lin_reg.hpp>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each output is predicted from the same input, reading the weights
+ *           and biases contiguously.
+ ********************************************************************************/
+void MultiOutputLinReg::Predict(const double input, double* outputs) const {
+    const auto weights{weights_.Data()};
+    const auto biases{biases_.Data()};
+    for (size_t o{}; o < num_outputs_; ++o) {
+        outputs[o] = weights[o] * input + biases[o];
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The training data is only accepted if the reference data holds
+ *           exactly num_outputs values per input value.
+ *        2. The training data, the train order and (if the number of outputs
+ *           has changed) the reset weights and biases are first built in
+ *           temporaries. They are only swapped into the model once every
+ *           allocation succeeded, so the model is unchanged on failure.
+ *        3. The weights and biases are kept as starting point for the training
+ *           if the number of outputs is unchanged.
+ ********************************************************************************/
+bool MultiOutputLinReg::LoadTrainingData(const container::Vector<double>& train_in,
+                                         const container::Vector<double>& train_out,
+                                         const size_t num_outputs) {
+    if (num_outputs == 0 || train_out.Size() != num_outputs * train_in.Size()) return false;
+    const auto reset{num_outputs != num_outputs_};
+    container::Vector<double> input{train_in}, reference{train_out}, weights{}, biases{};
+    container::Vector<size_t> order{};
+    if (input.Size() != train_in.Size() || reference.Size() != train_out.Size() ||
+        !order.Resize(train_in.Size()) ||
+        (reset && (!weights.Resize(num_outputs) || !biases.Resize(num_outputs)))) {
+        return false;
+    }
+    for (size_t i{}; i < order.Size(); ++i) {
+        order[i] = i;
+    }
+    train_in_.Swap(input);
+    train_out_.Swap(reference);
+    train_order_.Swap(order);
+    if (reset) {
+        for (size_t o{}; o < num_outputs; ++o) {
+            weights[o] = biases[o] = 0.0;
+        }
+        weights_.Swap(weights);
+        biases_.Swap(biases);
+        num_outputs_ = num_outputs;
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The training order is randomized before each epoch.
+ *        2. For each training set, the input is read once. The error of each
+ *           output is then calculated and its weight and bias adjusted
+ *           according to the error, the learning rate and the input value.
+ ********************************************************************************/
+void MultiOutputLinReg::Train(const size_t num_epochs, const double learning_rate) {
+    auto weights{weights_.Data()};
+    auto biases{biases_.Data()};
+    for (size_t i{}; i < num_epochs; ++i) {
+        RandomizeTrainingOrder();
+        for (const auto& j : train_order_) {
+            const auto input{train_in_[j]};
+            const auto references{train_out_.Data() + j * num_outputs_};
+            for (size_t o{}; o < num_outputs_; ++o) {
+                const auto error{(references[o] - (weights[o] * input + biases[o])) *
+                                 learning_rate};
+                biases[o] += error;
+                weights[o] += error * input;
+            }
+        }
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The first pass sums the inputs and the references of each output,
+ *           which gives the means.
+ *        2. The second pass sums the squared input deviations once and the
+ *           products of the input and reference deviations per output.
+ *        3. The weight of each output is its product sum divided by the shared
+ *           squared sum, and the bias is set so that the output passes through
+ *           the means.
+ ********************************************************************************/
+bool MultiOutputLinReg::Fit(void) {
+    const auto num_sets{train_in_.Size()};
+    if (num_sets == 0 || num_outputs_ == 0) return false;
+    container::Vector<double> sums{2 * num_outputs_};
+    if (sums.Size() != 2 * num_outputs_) return false;
+    for (auto& sum : sums) {
+        sum = 0.0;
+    }
+    auto y_means{sums.Data()};
+    auto sums_xy{y_means + num_outputs_};
+
+    double x_mean{};
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto references{train_out_.Data() + i * num_outputs_};
+        x_mean += train_in_[i];
+        for (size_t o{}; o < num_outputs_; ++o) {
+            y_means[o] += references[o];
+        }
+    }
+    x_mean /= num_sets;
+    for (size_t o{}; o < num_outputs_; ++o) {
+        y_means[o] /= num_sets;
+    }
+
+    double sum_xx{};
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto references{train_out_.Data() + i * num_outputs_};
+        const auto dx{train_in_[i] - x_mean};
+        sum_xx += dx * dx;
+        for (size_t o{}; o < num_outputs_; ++o) {
+            sums_xy[o] += dx * (references[o] - y_means[o]);
+        }
+    }
+    if (sum_xx == 0) return false;
+
+    for (size_t o{}; o < num_outputs_; ++o) {
+        weights_[o] = sums_xy[o] / sum_xx;
+        biases_[o] = y_means[o] - weights_[o] * x_mean;
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each set is predicted once for all outputs, and the squared error of
+ *           each output is summed and divided by the number of sets.
+ ********************************************************************************/
+bool MultiOutputLinReg::MeanSquaredErrors(const container::Vector<double>& input,
+                                          const container::Vector<double>& reference,
+                                          double* errors) const {
+    const auto num_sets{input.Size()};
+    if (num_sets == 0 || num_outputs_ == 0 || reference.Size() != num_sets * num_outputs_) {
+        return false;
+    }
+    for (size_t o{}; o < num_outputs_; ++o) {
+        errors[o] = 0.0;
+    }
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto references{reference.Data() + i * num_outputs_};
+        for (size_t o{}; o < num_outputs_; ++o) {
+            const auto error{references[o] - (weights_[o] * input[i] + biases_[o])};
+            errors[o] += error * error;
+        }
+    }
+    for (size_t o{}; o < num_outputs_; ++o) {
+        errors[o] /= num_sets;
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each index of the train order vector is swapped with a random index
+ *           from the generator of the model.
+ ********************************************************************************/
+void MultiOutputLinReg::RandomizeTrainingOrder(void) {
+    for (size_t i{}; i < train_order_.Size(); ++i) {
+        const auto r{random_.Next(train_order_.Size())};
+        const auto temp{train_order_[i]};
+        train_order_[i] = train_order_[r];
+        train_order_[r] = temp;
+    }
+}
+
+} /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,160 @@
+/********************************************************************************
+ * @brief Library for implementing multi-output linear regression models in C++,
+ *        i.e. several models sharing the same input.
+ ********************************************************************************/
+#pragma once
+
+#include <vector.hpp>
+#include <stdint.h>
+#include <stdlib.h>
+#include <xorshift.hpp>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing multi-output linear regression models, where
+ *        each output is predicted from the same input as
+ *
+ *                             y_pred[o] = k[o] * x + m[o].
+ *
+ *        This replaces one LinReg per derived quantity (e.g. temperature,
+ *        humidity correction and offset from the same ADC input). The input is
+ *        read once per set for all outputs, both when training and predicting.
+ *
+ *        The reference data is stored row-major, i.e. all outputs of the first
+ *        set followed by all outputs of the second set and so on, so the outputs
+ *        of a set are contiguous. The weights and biases are stored contiguously
+ *        too, so the per-output loops are vectorizable.
+ ********************************************************************************/
+class MultiOutputLinReg {
+  public:
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty regression model.
+     ********************************************************************************/
+    MultiOutputLinReg(void) = default;
+
+    /********************************************************************************
+     * @brief Makes a prediction of all outputs with the specified input value.
+     *
+     * @param input
+     *        The input value (x) to predict with.
+     * @param outputs
+     *        Pointer to array of NumOutputs values to store the predictions in.
+     ********************************************************************************/
+    void Predict(const double input, double* outputs) const;
+
+    /********************************************************************************
+     * @brief Makes a prediction of one output with the specified input value.
+     *
+     * @param input
+     *        The input value (x) to predict with.
+     * @param output
+     *        The index of the output to predict.
+     * @return
+     *        The predicted value (0 if the output doesn't exist).
+     ********************************************************************************/
+    double Predict(const double input, const size_t output) const {
+        return output < num_outputs_ ? weights_[output] * input + biases_[output] : 0.0;
+    }
+
+    /********************************************************************************
+     * @brief Provides the number of outputs of the model.
+     ********************************************************************************/
+    size_t NumOutputs(void) const { return num_outputs_; }
+
+    /********************************************************************************
+     * @brief Provides the weights (k-values) of the model, one per output.
+     ********************************************************************************/
+    const container::Vector<double>& Weights(void) const { return weights_; }
+
+    /********************************************************************************
+     * @brief Provides the biases (m-values) of the model, one per output.
+     ********************************************************************************/
+    const container::Vector<double>& Biases(void) const { return biases_; }
+
+    /********************************************************************************
+     * @brief Loads training data into the model.
+     *
+     * @param train_in
+     *        Reference to vector containing input data (x).
+     * @param train_out
+     *        Reference to vector containing reference data (y_ref), num_outputs
+     *        values per set, stored row-major.
+     * @param num_outputs
+     *        The number of outputs per set.
+     * @return
+     *        True if the training data was loaded, false if the sizes don't match
+     *        or the memory couldn't be allocated.
+     ********************************************************************************/
+    bool LoadTrainingData(const container::Vector<double>& train_in,
+                          const container::Vector<double>& train_out, const size_t num_outputs);
+
+    /********************************************************************************
+     * @brief Trains all outputs of the model with specified parameters. Each
+     *        training set is read once per epoch and used to adjust all outputs.
+     *
+     * @param num_epochs
+     *        The number of epochs to train the model.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors (default = 0.01).
+     ********************************************************************************/
+    void Train(const size_t num_epochs, const double learning_rate = 0.01);
+
+    /********************************************************************************
+     * @brief Seeds the random generator of the model, which makes the training 
+     *        reproducible. If never called, the generator is seeded from the 
+     *        time the first time it's used.
+     *
+     * @param seed
+     *        The seed to use (0 is replaced by 1).
+     ********************************************************************************/
+    void SetRandomSeed(const uint32_t seed) { random_.Seed(seed); }
+
+    /********************************************************************************
+     * @brief Fits all outputs of the model to the stored training data with the
+     *        closed-form least squares solution. The input statistics are shared
+     *        by all outputs, so this costs two passes over the training data in
+     *        total rather than two per output.
+     *
+     * @return
+     *        True if the model was fitted, false if there's no training data, all
+     *        inputs are equal or the memory couldn't be allocated.
+     ********************************************************************************/
+    bool Fit(void);
+
+    /********************************************************************************
+     * @brief Calculates the mean squared error of each output on specified data.
+     *
+     * @param input
+     *        Reference to vector containing input data (x).
+     * @param reference
+     *        Reference to vector containing reference data (y_ref), stored
+     *        row-major as the training data.
+     * @param errors
+     *        Pointer to array of NumOutputs values to store the errors in.
+     * @return
+     *        True if the errors were calculated, false if the sizes don't match.
+     ********************************************************************************/
+    bool MeanSquaredErrors(const container::Vector<double>& input,
+                           const container::Vector<double>& reference, double* errors) const;
+
+  /********************************************************************************
+   * @note The private segment is only visible internally (i.e. in this class).
+   ********************************************************************************/
+  private:
+    container::Vector<double> train_in_{};    /* Input values (x). */
+    container::Vector<double> train_out_{};   /* Reference values, row-major. */
+    container::Vector<size_t> train_order_{}; /* Stores indexes for training sets. */
+    container::Vector<double> weights_{};     /* k-values, one per output. */
+    container::Vector<double> biases_{};      /* m-values, one per output. */
+    size_t num_outputs_{};                    /* Number of outputs. */
+    Xorshift32 random_{};                     /* Random generator of the model. */
+
+    /********************************************************************************
+     * @brief Randomizes the training order before each new epoch.
+     ********************************************************************************/
+    void RandomizeTrainingOrder(void);
+};
+
+} /* namespace yrgo */
\ No newline at end of file
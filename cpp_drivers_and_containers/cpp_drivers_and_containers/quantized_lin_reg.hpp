@@ -0,0 +1,163 @@
+/********************************************************************************
+ * @brief Library for integer inference of trained multiple linear regression
+ *        models, i.e. post-training quantization of MultiLinReg to int8 or
+ *        int16 weights for microcontrollers without floating-point hardware.
+ ********************************************************************************/
+#pragma once
+
+#include <multi_lin_reg.hpp>
+#include <type_traits.hpp>
+#include <vector.hpp>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for integer inference of a multiple linear regression model
+ *        whose inputs are integer codes, e.g. ADC readings of several channels.
+ *
+ *        The input of feature j is given by its code via a per-feature scale
+ *        and offset, x_j = scale_j * code_j + offset_j, so the prediction is
+ *
+ *              y_pred = sum(k_j * scale_j * code_j) + m + sum(k_j * offset_j).
+ *
+ *        The per-feature scales are folded into the weights, and the offsets
+ *        into the bias. The folded weights are then quantized with one shared
+ *        output scale S to integers q_j = round(k_j * scale_j / S), where S maps
+ *        the largest folded weight to the largest value of T. The prediction is
+ *
+ *                        y_pred = S * sum(q_j * code_j) + bias,
+ *
+ *        where the sum is calculated with integer multiplications accumulated
+ *        in int32 and only the final scaling is done in floating point (or not
+ *        at all, if the caller works with the raw sum). The rounding error of
+ *        the prediction is at most S / 2 * sum(|code_j|).
+ *
+ *        A shared output scale keeps the inner loop integer-only. Features with
+ *        folded weights much smaller than the largest one are quantized coarser,
+ *        which is what int16 weights are for.
+ *
+ * @tparam T
+ *         The weight type, int8_t or int16_t. Codes up to 16 bits are supported
+ *         with int8_t weights. With int16_t weights, the sum of |q_j * code_j|
+ *         must fit in int32, e.g. 10-bit ADC codes for up to 64 features.
+ ********************************************************************************/
+template <typename T>
+class QuantizedLinReg {
+    static_assert(type_traits::is_signed<T>::value && sizeof(T) <= 2,
+                  "Quantized weights must be of type int8_t or int16_t!");
+  public:
+
+    /********************************************************************************
+     * @brief The largest quantized weight.
+     ********************************************************************************/
+    static constexpr int32_t kMaxWeight{(static_cast<int32_t>(1) << (8 * sizeof(T) - 1)) - 1};
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty model predicting 0.
+     ********************************************************************************/
+    QuantizedLinReg(void) = default;
+
+    /********************************************************************************
+     * @brief Quantizes specified trained model.
+     *
+     * @param model
+     *        Reference to the trained model.
+     * @param input_scales
+     *        Pointer to array holding the scale of each feature, i.e. the input
+     *        value per code step.
+     * @param input_offsets
+     *        Pointer to array holding the offset of each feature, i.e. the input
+     *        value at code 0 (default = nullptr, all offsets 0).
+     * @return
+     *        True if the model was quantized, false if the model has no features
+     *        or the memory couldn't be allocated.
+     ********************************************************************************/
+    bool Quantize(const MultiLinReg& model, const double* input_scales,
+                  const double* input_offsets = nullptr) {
+        const auto num_features{model.NumFeatures()};
+        if (num_features == 0 || !weights_.Resize(num_features)) return false;
+        const auto& weights{model.Weights()};
+
+        double max_weight{};
+        bias_ = model.Bias();
+        for (size_t j{}; j < num_features; ++j) {
+            const auto folded{weights[j] * input_scales[j]};
+            const auto magnitude{folded < 0 ? -folded : folded};
+            if (magnitude > max_weight) max_weight = magnitude;
+            if (input_offsets != nullptr) bias_ += weights[j] * input_offsets[j];
+        }
+        output_scale_ = max_weight > 0 ? max_weight / kMaxWeight : 1.0;
+
+        for (size_t j{}; j < num_features; ++j) {
+            const auto scaled{weights[j] * input_scales[j] / output_scale_};
+            auto quantized{static_cast<int32_t>(scaled < 0 ? scaled - 0.5 : scaled + 0.5)};
+            if (quantized > kMaxWeight) quantized = kMaxWeight;
+            if (quantized < -kMaxWeight) quantized = -kMaxWeight;
+            weights_[j] = static_cast<T>(quantized);
+        }
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Calculates the integer sum of the quantized weights multiplied by
+     *        specified codes, i.e. the prediction in units of the output scale
+     *        (without the bias).
+     *
+     * @param codes
+     *        Pointer to array holding the code of each feature.
+     * @return
+     *        The integer sum.
+     ********************************************************************************/
+    int32_t Accumulate(const int16_t* codes) const {
+        const auto weights{weights_.Data()};
+        int32_t sum{};
+        for (size_t j{}; j < weights_.Size(); ++j) {
+            sum += static_cast<int32_t>(weights[j]) * codes[j];
+        }
+        return sum;
+    }
+
+    /********************************************************************************
+     * @brief Makes a prediction with specified codes.
+     *
+     * @param codes
+     *        Pointer to array holding the code of each feature.
+     * @return
+     *        The predicted value.
+     ********************************************************************************/
+    double Predict(const int16_t* codes) const {
+        return Accumulate(codes) * output_scale_ + bias_;
+    }
+
+    /********************************************************************************
+     * @brief Provides the number of features of the model.
+     ********************************************************************************/
+    size_t NumFeatures(void) const { return weights_.Size(); }
+
+    /********************************************************************************
+     * @brief Provides the quantized weights of the model.
+     ********************************************************************************/
+    const container::Vector<T>& Weights(void) const { return weights_; }
+
+    /********************************************************************************
+     * @brief Provides the output scale, i.e. the output value per integer step.
+     ********************************************************************************/
+    double OutputScale(void) const { return output_scale_; }
+
+    /********************************************************************************
+     * @brief Provides the bias, including the folded input offsets.
+     ********************************************************************************/
+    double Bias(void) const { return bias_; }
+
+  /********************************************************************************
+   * @note The private segment is only visible internally (i.e. in this class).
+   ********************************************************************************/
+  private:
+    container::Vector<T> weights_{}; /* Quantized weights, one per feature. */
+    double output_scale_{1.0};       /* Output value per integer step. */
+    double bias_{};                  /* m-value including folded offsets. */
+};
+
+} /* namespace yrgo */
\ No newline at end of file
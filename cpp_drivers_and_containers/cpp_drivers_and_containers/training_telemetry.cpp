@@ -0,0 +1,129 @@
+/********************************************************************************
+ * @brief Implementation details for the TrainingTelemetry class.
+ ********************************************************************************/
+#include <training_telemetry.hpp>
+#include <math.h>
+#include <stdio.h>
+
+namespace yrgo {
+
+namespace {
+
+/********************************************************************************
+ * @brief Formats specified value in scientific notation with six significant 
+ *        digits, e.g. -1.23457e-5. Only integers are passed to sprintf, since
+ *        floating-point support is left out of printf on AVR by default.
+ *
+ * @param value
+ *        The value to format.
+ * @param s
+ *        Pointer to buffer of at least 16 characters.
+ * @return
+ *        Pointer to the terminating null character of the formatted value.
+ ********************************************************************************/
+char* FormatDouble(const double value, char* s) {
+    if (isnan(value)) return s + sprintf(s, "NaN");
+    if (isinf(value)) return s + sprintf(s, value > 0 ? "Infinity" : "-Infinity");
+    if (value == 0) return s + sprintf(s, "0");
+    const auto magnitude{fabs(value)};
+    auto exponent{static_cast<int>(floor(log10(magnitude)))};
+    auto mantissa{static_cast<int32_t>(lround(magnitude / pow(10.0, exponent) * 100000.0))};
+    if (mantissa >= 1000000) {
+        mantissa /= 10;
+        exponent++;
+    }
+    return s + sprintf(s, "%s%ld.%05lde%d", value < 0 ? "-" : "", static_cast<long>(mantissa / 100000),
+                       static_cast<long>(mantissa % 100000), exponent);
+}
+
+} /* namespace */
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The record is written at the head, which is then advanced and 
+ *           wrapped around at the end of the buffer.
+ *        2. The count is increased until the buffer is full.
+ ********************************************************************************/
+void TrainingTelemetry::Add(const Record& record) {
+    if (records_.Size() == 0) return;
+    records_[head_] = record;
+    head_ = head_ + 1 < records_.Size() ? head_ + 1 : 0;
+    if (count_ < records_.Size()) count_++;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The newest record is stored just before the head, so the record of
+ *           specified age is stored age + 1 positions before the head.
+ ********************************************************************************/
+bool TrainingTelemetry::Read(const size_t age, Record& record) const {
+    if (age >= count_) return false;
+    record = records_[(head_ + records_.Size() - 1 - age) % records_.Size()];
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The header is written, followed by one line per record from the
+ *           oldest to the newest record.
+ *        2. The ticks column is only written if a tick function is set.
+ ********************************************************************************/
+void TrainingTelemetry::WriteCsv(const WriteFunction write) const {
+    char s[kLineSize]{'\0'};
+    const auto ticks{tick_ != nullptr};
+    write(ticks ? "epoch,loss,weight_delta,bias_delta,ticks\n" : 
+                  "epoch,loss,weight_delta,bias_delta\n");
+    for (size_t age{count_}; age > 0; --age) {
+        Record record{};
+        Read(age - 1, record);
+        Format(record, false, age == 1, ticks, s);
+        write(s);
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The array is opened, followed by one object per line from the
+ *           oldest to the newest record, and closed.
+ *        2. The ticks field is only written if a tick function is set.
+ ********************************************************************************/
+void TrainingTelemetry::WriteJson(const WriteFunction write) const {
+    char s[kLineSize]{'\0'};
+    write("[\n");
+    for (size_t age{count_}; age > 0; --age) {
+        Record record{};
+        Read(age - 1, record);
+        Format(record, true, age == 1, tick_ != nullptr, s);
+        write(s);
+    }
+    write("]\n");
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The fields are formatted one at a time, where each formatting 
+ *           returns the end of the string so far.
+ *        2. Non-finite losses (a diverged training) are written as NaN or
+ *           Infinity in CSV and as null in JSON, since JSON lacks them.
+ *        3. Without ticks, the line ends right after the bias delta.
+ ********************************************************************************/
+void TrainingTelemetry::Format(const Record& record, const bool json, const bool last, 
+                               const bool ticks, char* s) {
+    const auto field{[json](const double value, char* s) {
+        return json && !isfinite(value) ? s + sprintf(s, "null") : FormatDouble(value, s);
+    }};
+    s += sprintf(s, json ? "  {\"epoch\": %lu, \"loss\": " : "%lu,", 
+                 static_cast<unsigned long>(record.epoch));
+    s = field(record.loss, s);
+    s += sprintf(s, json ? ", \"weight_delta\": " : ",");
+    s = field(record.weight_delta, s);
+    s += sprintf(s, json ? ", \"bias_delta\": " : ",");
+    s = field(record.bias_delta, s);
+    if (ticks) {
+        s += sprintf(s, json ? ", \"ticks\": %lu" : ",%lu", 
+                     static_cast<unsigned long>(record.ticks));
+    }
+    sprintf(s, json ? "}%s\n" : "%s\n", json && !last ? "," : "");
+}
+
+} /* namespace yrgo */
\ No newline at end of file
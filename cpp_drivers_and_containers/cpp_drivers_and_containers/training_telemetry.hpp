@@ -0,0 +1,180 @@
+/********************************************************************************
+ * @brief Library for recording per-epoch training telemetry in a ring buffer.
+ ********************************************************************************/
+#pragma once
+
+#include <vector.hpp>
+#include <stdint.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for recording the convergence of a training, one record per
+ *        recorded epoch, in a fixed-size ring buffer. Once full, the oldest
+ *        record is overwritten. The buffer is allocated once at construction,
+ *        so recording never allocates memory.
+ *
+ *        The telemetry is attached to a model, see LinReg::SetTelemetry. The
+ *        model doesn't calculate the loss unless the telemetry is attached and
+ *        the epoch is to be recorded, so training without telemetry costs
+ *        nothing extra.
+ ********************************************************************************/
+class TrainingTelemetry {
+  public:
+
+    /********************************************************************************
+     * @brief Struct holding the telemetry of one epoch.
+     *
+     * @param epoch
+     *        The number of the epoch (the first epoch is 1).
+     * @param loss
+     *        The mean squared error of the epoch, calculated from the error of
+     *        each training set just before the parameters were adjusted.
+     * @param weight_delta
+     *        The change of the weight (k-value) during the epoch.
+     * @param bias_delta
+     *        The change of the bias (m-value) during the epoch.
+     * @param ticks
+     *        The elapsed ticks of the epoch according to the tick function.
+     ********************************************************************************/
+    struct Record {
+        uint32_t epoch;
+        double loss;
+        double weight_delta;
+        double bias_delta;
+        uint32_t ticks;
+    };
+
+    /********************************************************************************
+     * @brief Function returning the current tick count, e.g. a timer counter on
+     *        target or microseconds on the host.
+     ********************************************************************************/
+    using TickFunction = uint32_t (*)(void);
+
+    /********************************************************************************
+     * @brief Function writing a null-terminated string, e.g. serial::Print on
+     *        target or fputs to a file on the host.
+     ********************************************************************************/
+    using WriteFunction = void (*)(const char*);
+
+    /********************************************************************************
+     * @brief Creates telemetry with specified capacity.
+     *
+     * @param capacity
+     *        The number of records the ring buffer can hold (default = 8).
+     * @param interval
+     *        Records every interval:th epoch, so that long trainings can be 
+     *        covered with a small buffer (default = 1, i.e. every epoch).
+     * @param tick
+     *        Function providing the current tick count, or nullptr to record
+     *        zero ticks (default = nullptr).
+     ********************************************************************************/
+    explicit TrainingTelemetry(const size_t capacity = 8, const uint32_t interval = 1,
+                               const TickFunction tick = nullptr)
+        : records_{capacity}, interval_{interval}, tick_{tick} {}
+
+    /********************************************************************************
+     * @brief Indicates if specified epoch is to be recorded.
+     *
+     * @param epoch
+     *        The number of the epoch.
+     * @return
+     *        True if the epoch is to be recorded, else false.
+     ********************************************************************************/
+    bool Due(const uint32_t epoch) const {
+        return records_.Size() > 0 && interval_ > 0 && epoch % interval_ == 0;
+    }
+
+    /********************************************************************************
+     * @brief Provides the current tick count.
+     *
+     * @return
+     *        The current tick count, or 0 if no tick function is set.
+     ********************************************************************************/
+    uint32_t Ticks(void) const { return tick_ != nullptr ? tick_() : 0; }
+
+    /********************************************************************************
+     * @brief Adds a record, overwriting the oldest record if the buffer is full.
+     *
+     * @param record
+     *        Reference to the record to add.
+     ********************************************************************************/
+    void Add(const Record& record);
+
+    /********************************************************************************
+     * @brief Reads a record from the buffer.
+     *
+     * @param age
+     *        The age of the record, where 0 is the newest record.
+     * @param record
+     *        Reference to the record to read into.
+     * @return
+     *        True if a record of specified age exists, else false.
+     ********************************************************************************/
+    bool Read(const size_t age, Record& record) const;
+
+    /********************************************************************************
+     * @brief Provides the number of stored records.
+     ********************************************************************************/
+    size_t NumRecords(void) const { return count_; }
+
+    /********************************************************************************
+     * @brief Provides the maximum number of stored records.
+     ********************************************************************************/
+    size_t Capacity(void) const { return records_.Size(); }
+
+    /********************************************************************************
+     * @brief Removes all records.
+     ********************************************************************************/
+    void Clear(void) {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    /********************************************************************************
+     * @brief Writes the stored records as CSV, oldest first, with the header
+     *        epoch,loss,weight_delta,bias_delta,ticks. The ticks column is left
+     *        out if no tick function is set, since it would only hold zeros.
+     *
+     * @param write
+     *        Function writing each line of the output.
+     ********************************************************************************/
+    void WriteCsv(const WriteFunction write) const;
+
+    /********************************************************************************
+     * @brief Writes the stored records as a JSON array of objects, oldest first.
+     *        The ticks field is left out if no tick function is set.
+     *
+     * @param write
+     *        Function writing each line of the output.
+     ********************************************************************************/
+    void WriteJson(const WriteFunction write) const;
+
+  private:
+    container::Vector<Record> records_; /* Ring buffer holding the records. */
+    uint32_t interval_;                 /* Number of epochs between records. */
+    TickFunction tick_;                 /* Function providing the tick count. */
+    size_t head_{};                     /* Index of the next record to write. */
+    size_t count_{};                    /* Number of stored records. */
+
+    /********************************************************************************
+     * @brief Formats a record as a CSV or JSON line.
+     *
+     * @param record
+     *        Reference to the record to format.
+     * @param json
+     *        True to format as JSON object, false to format as CSV line.
+     * @param last
+     *        True if the record is the last one (no trailing comma in JSON).
+     * @param ticks
+     *        True to include the ticks of the record.
+     * @param s
+     *        Pointer to buffer of at least kLineSize characters.
+     ********************************************************************************/
+    static void Format(const Record& record, const bool json, const bool last, const bool ticks,
+                       char* s);
+
+    static constexpr size_t kLineSize{128}; /* Size of the buffer for one line. */
+};
+
+} /* namespace yrgo */
\ No newline at end of file
@@ -1,149 +1,162 @@
-/********************************************************************************
- * @brief Contains type traits for static checking of data types.
- ********************************************************************************/
-#pragma once
-
-#include <stdint.h>
-
-namespace yrgo {
-namespace type_traits {
-
-/********************************************************************************
- * @brief Indicates if specified type T is of unsigned integral type.
- *
- * @param value
- *        Constant set to true for unsigned integral types, false for others.
- ********************************************************************************/
-template <typename T>
-struct is_unsigned {
-	static const bool value{false};
-};
-
-/********************************************************************************
- * @brief Declares uint8_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint8_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares uint16_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint16_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares uint32_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint32_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares uint64_t as a valid unsigned integral type.
- ********************************************************************************/
-template <>
-struct is_unsigned<uint64_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of signed integral type.
- *
- * @param value
- *        Constant set to true for signed integral types, false for other types.
- ********************************************************************************/
-template <typename T>
-struct is_signed {
-	static const bool value{false};
-};
-
-/********************************************************************************
- * @brief Declares int8_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int8_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares int16_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int16_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares int32_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int32_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares int64_t as a valid signed integral type.
- ********************************************************************************/
-template <>
-struct is_signed<int64_t> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of integral type, which encompasses
- *        both signed and unsigned integers.
- *
- * @param value
- *        Constant set to true for integral types, false for others.
- ********************************************************************************/
-template <typename T>
-struct is_integral {
-    static const bool value{is_unsigned<T>::value || is_signed<T>::value};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of floating-point type.
- *
- * @param value
- *        Constant set to true for floating-point types, false for others.
- ********************************************************************************/
-template <typename T>
-struct is_floating_point {
-	static const bool value{false};
-};
-
-/********************************************************************************
- * @brief Declares float as a valid floating-point type.
- ********************************************************************************/
-template <>
-struct is_floating_point<float> {
-    static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Declares double as a valid floating-point type.
- ********************************************************************************/
-template <>
-struct is_floating_point<double> {
-	static const bool value{true};
-};
-
-/********************************************************************************
- * @brief Indicates if specified type T is of arithmetic type, i.e. of integral
- *        of floating-point type.
- *
- * @param value
- *        Constant set to true for arithmetic types, false for others.
- ********************************************************************************/
-template <typename T>
-struct is_arithmetic {
-    static const bool value{is_integral<T>::value || is_floating_point<T>::value};
-};
-
-} /* namespace type_traits */
+/********************************************************************************
+ * @brief Contains type traits for static checking of data types.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace yrgo {
+namespace type_traits {
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of unsigned integral type.
+ *
+ * @param value
+ *        Constant set to true for unsigned integral types, false for others.
+ ********************************************************************************/
+template <typename T>
+struct is_unsigned {
+	static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares uint8_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint8_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares uint16_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint16_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares uint32_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint32_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares uint64_t as a valid unsigned integral type.
+ ********************************************************************************/
+template <>
+struct is_unsigned<uint64_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of signed integral type.
+ *
+ * @param value
+ *        Constant set to true for signed integral types, false for other types.
+ ********************************************************************************/
+template <typename T>
+struct is_signed {
+	static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares int8_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int8_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares int16_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int16_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares int32_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int32_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares int64_t as a valid signed integral type.
+ ********************************************************************************/
+template <>
+struct is_signed<int64_t> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of integral type, which encompasses
+ *        both signed and unsigned integers.
+ *
+ * @param value
+ *        Constant set to true for integral types, false for others.
+ ********************************************************************************/
+template <typename T>
+struct is_integral {
+    static const bool value{is_unsigned<T>::value || is_signed<T>::value};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of floating-point type.
+ *
+ * @param value
+ *        Constant set to true for floating-point types, false for others.
+ ********************************************************************************/
+template <typename T>
+struct is_floating_point {
+	static const bool value{false};
+};
+
+/********************************************************************************
+ * @brief Declares float as a valid floating-point type.
+ ********************************************************************************/
+template <>
+struct is_floating_point<float> {
+    static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Declares double as a valid floating-point type.
+ ********************************************************************************/
+template <>
+struct is_floating_point<double> {
+	static const bool value{true};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is of arithmetic type, i.e. of integral
+ *        of floating-point type.
+ *
+ * @param value
+ *        Constant set to true for arithmetic types, false for others.
+ ********************************************************************************/
+template <typename T>
+struct is_arithmetic {
+    static const bool value{is_integral<T>::value || is_floating_point<T>::value};
+};
+
+/********************************************************************************
+ * @brief Indicates if specified type T is trivially copyable, i.e. if objects
+ *        of the type can be copied byte by byte, for instance to and from
+ *        EEPROM or a file.
+ *
+ * @param value
+ *        Constant set to true for trivially copyable types, false for others.
+ ********************************************************************************/
+template <typename T>
+struct is_trivially_copyable {
+    static const bool value{__is_trivially_copyable(T)};
+};
+
+} /* namespace type_traits */
 } /* namespace yrgo */
\ No newline at end of file
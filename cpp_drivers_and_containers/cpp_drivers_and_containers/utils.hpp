@@ -1,199 +1,199 @@
-/********************************************************************************
- * @brief Contains miscellaneous utility functions for bit operations, 
- *        mathematical operations and generating delays.
- ********************************************************************************/
-#pragma once
-
-#define F_CPU 16000000UL
-
-#include <stdint.h>
-#include <stdlib.h>
-#include <stdio.h>
-#include <avr/interrupt.h>
-#include <util/delay.h>
-#include <type_traits.hpp>
-
-namespace yrgo {
-namespace driver {
-namespace utils {
-namespace {
-
-/********************************************************************************
- * @brief Sets specified bit of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The specified bit to set.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr void Set(volatile T& reg, const uint8_t bit)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
-	reg |= (1ULL << bit);
-}
-
-/********************************************************************************
- * @brief Sets specified bits of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The first bit to set.
- * @param bits
- *        The others bits to set.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr void Set(volatile T& reg, const uint8_t bit, Bits... bits...)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
-    Set(reg, bit);
-	Set(reg, bits...);
-}
-
-/********************************************************************************
- * @brief Clears specified bit of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The specified bit to clear.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr void Clear(volatile T& reg, const uint8_t bit)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
-    reg &= ~(1ULL << bit);
-}
-
-/********************************************************************************
- * @brief Clears specified bits of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The first bit to clear.
- * @param bits
- *        The others bits to clear.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr void Clear(volatile T& reg, const uint8_t bit, Bits... bits...)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid datatype used for bit manipulation!");
-    Clear(reg, bit);
-	Clear(reg, bits...);
-}
-
-/********************************************************************************
- * @brief Toggles specified bit of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The specified bit to toggle.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr void Toggle(volatile T& reg, const uint8_t bit)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid datatype used for bit manipulation!");
-    reg ^= (1ULL << bit);
-}
-
-/********************************************************************************
- * @brief Toggles specified bits of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The first bit to toggle.
- * @param bits
- *        The others bits to toggle.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr void Toggle(volatile T& reg, const uint8_t bit, Bits... bits...)  {
-    Toggle(reg, bit);
-	Toggle(reg, bits...);
-}
-
-/********************************************************************************
- * @brief Reads specified bit of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The specified bit to read.
- * @return
- *        True if the specified bit is high, else false.
- ********************************************************************************/
-template <typename T = uint8_t>
-constexpr bool Read(const volatile T& reg, const uint8_t bit)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
-    return reg & (1ULL << bit);
-}
-
-/********************************************************************************
- * @brief Reads specified bits of selected register.
- *
- * @param reg
- *        The destination register.
- * @param bit
- *        The first bit to read.
- * @param bits
- *        The other bits to read.
- * @return
- *        True if at least one of the specified bits is high, else false.
- ********************************************************************************/
-template <typename T = uint8_t, typename... Bits>
-constexpr bool Read(const volatile T& reg, const uint8_t bit, Bits... bits...)  {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
-    return Read(reg, bit) | Read(reg, bits...);
-}
-
-/********************************************************************************
- * @brief Blocks the calling thread for the specified time measured in seconds.
- *
- * @param delay_time_s
- *        The time to block the thread in seconds.
- ********************************************************************************/
-inline void Delay_s(const uint16_t&& delay_time_s) {
-    for (uint16_t i{}; i < delay_time_s; ++i) {
-	    _delay_ms(1000);
-	}
-}
-
-/********************************************************************************
- * @brief Blocks the calling thread for the specified time measured in 
- *        milliseconds.
- *
- * @param delay_time_ms
- *        The time to block the thread in milliseconds.
- ********************************************************************************/
-inline void Delay_ms(const uint16_t& delay_time_ms) {
-    for (uint16_t i{}; i < delay_time_ms; ++i) {
-	    _delay_ms(1);
-	}
-}
-
-/********************************************************************************
- * @brief Blocks the calling thread for the specified time measured in 
- *        microseconds.
- *
- * @param delay_time_us
- *        The time to block the thread in microseconds.
- ********************************************************************************/
-inline void Delay_us(const uint16_t&& delay_time_us) {
-	for (uint16_t i{}; i < delay_time_us; ++i) {
-	    _delay_us(1);
-	}
-}
-
-/********************************************************************************
- * @brief Calculates the power of specified base and exponent, where
- *
- *                           power = base ^ exponent
- *
- * @param base 
- *        Specified base.
- * @param exponent
- *        Specified exponent.
- * @return
- *        The corresponding power.
- ********************************************************************************/
+/********************************************************************************
+ * @brief Contains miscellaneous utility functions for bit operations, 
+ *        mathematical operations and generating delays.
+ ********************************************************************************/
+#pragma once
+
+#define F_CPU 16000000UL
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <avr/interrupt.h>
+#include <util/delay.h>
+#include <type_traits.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace utils {
+namespace {
+
+/********************************************************************************
+ * @brief Sets specified bit of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The specified bit to set.
+ ********************************************************************************/
+template <typename T = uint8_t>
+constexpr void Set(volatile T& reg, const uint8_t bit)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
+	reg |= (1ULL << bit);
+}
+
+/********************************************************************************
+ * @brief Sets specified bits of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The first bit to set.
+ * @param bits
+ *        The others bits to set.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr void Set(volatile T& reg, const uint8_t bit, Bits... bits...)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
+    Set(reg, bit);
+	Set(reg, bits...);
+}
+
+/********************************************************************************
+ * @brief Clears specified bit of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The specified bit to clear.
+ ********************************************************************************/
+template <typename T = uint8_t>
+constexpr void Clear(volatile T& reg, const uint8_t bit)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
+    reg &= ~(1ULL << bit);
+}
+
+/********************************************************************************
+ * @brief Clears specified bits of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The first bit to clear.
+ * @param bits
+ *        The others bits to clear.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr void Clear(volatile T& reg, const uint8_t bit, Bits... bits...)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid datatype used for bit manipulation!");
+    Clear(reg, bit);
+	Clear(reg, bits...);
+}
+
+/********************************************************************************
+ * @brief Toggles specified bit of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The specified bit to toggle.
+ ********************************************************************************/
+template <typename T = uint8_t>
+constexpr void Toggle(volatile T& reg, const uint8_t bit)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid datatype used for bit manipulation!");
+    reg ^= (1ULL << bit);
+}
+
+/********************************************************************************
+ * @brief Toggles specified bits of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The first bit to toggle.
+ * @param bits
+ *        The others bits to toggle.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr void Toggle(volatile T& reg, const uint8_t bit, Bits... bits...)  {
+    Toggle(reg, bit);
+	Toggle(reg, bits...);
+}
+
+/********************************************************************************
+ * @brief Reads specified bit of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The specified bit to read.
+ * @return
+ *        True if the specified bit is high, else false.
+ ********************************************************************************/
+template <typename T = uint8_t>
+constexpr bool Read(const volatile T& reg, const uint8_t bit)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
+    return reg & (1ULL << bit);
+}
+
+/********************************************************************************
+ * @brief Reads specified bits of selected register.
+ *
+ * @param reg
+ *        The destination register.
+ * @param bit
+ *        The first bit to read.
+ * @param bits
+ *        The other bits to read.
+ * @return
+ *        True if at least one of the specified bits is high, else false.
+ ********************************************************************************/
+template <typename T = uint8_t, typename... Bits>
+constexpr bool Read(const volatile T& reg, const uint8_t bit, Bits... bits...)  {
+    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit manipulation!");
+    return Read(reg, bit) | Read(reg, bits...);
+}
+
+/********************************************************************************
+ * @brief Blocks the calling thread for the specified time measured in seconds.
+ *
+ * @param delay_time_s
+ *        The time to block the thread in seconds.
+ ********************************************************************************/
+inline void Delay_s(const uint16_t&& delay_time_s) {
+    for (uint16_t i{}; i < delay_time_s; ++i) {
+	    _delay_ms(1000);
+	}
+}
+
+/********************************************************************************
+ * @brief Blocks the calling thread for the specified time measured in 
+ *        milliseconds.
+ *
+ * @param delay_time_ms
+ *        The time to block the thread in milliseconds.
+ ********************************************************************************/
+inline void Delay_ms(const uint16_t& delay_time_ms) {
+    for (uint16_t i{}; i < delay_time_ms; ++i) {
+	    _delay_ms(1);
+	}
+}
+
+/********************************************************************************
+ * @brief Blocks the calling thread for the specified time measured in 
+ *        microseconds.
+ *
+ * @param delay_time_us
+ *        The time to block the thread in microseconds.
+ ********************************************************************************/
+inline void Delay_us(const uint16_t&& delay_time_us) {
+	for (uint16_t i{}; i < delay_time_us; ++i) {
+	    _delay_us(1);
+	}
+}
+
+/********************************************************************************
+ * @brief Calculates the power of specified base and exponent, where
+ *
+ *                           power = base ^ exponent
+ *
+ * @param base 
+ *        Specified base.
+ * @param exponent
+ *        Specified exponent.
+ * @return
+ *        The corresponding power.
+ ********************************************************************************/
 template <typename T1 = double, typename T2 = double, typename T3 = double>
 inline T3 Power(const T1 base, const T2 exponent) {
 	static_assert(type_traits::is_arithmetic<T1>::value &&
@@ -206,33 +206,110 @@ inline T3 Power(const T1 base, const T2 exponent) {
     }
     return static_cast<T3>(num);
 }
-
-/********************************************************************************
- * @brief Enables interrupts globally.
- ********************************************************************************/
-inline void GlobalInterruptEnable(void) { asm("SEI"); }
-
-/********************************************************************************
- * @brief Disables interrupts globally.
- ********************************************************************************/
-inline void GlobalInterruptDisable(void) { asm("CLI"); }
-
-/********************************************************************************
- * @brief Rounds the specified number to the nearest integer.
- *
- * @param number
- *        The number to round.
- * @return
- *        The corresponding rounded number.
- ********************************************************************************/
-template <typename T1 = int32_t, typename T2 = double>
-constexpr T1 Round(const T2 value) {
-    static_assert(type_traits::is_integral<T1>::value && type_traits::is_arithmetic<T2>::value, 
-	              "Rounding only possible for arithmetic types!");
-    return static_cast<T1>(value + 0.5);
-}
-
-} /* namespace */
-} /* namespace utils */
-} /* namespace driver */
+
+/********************************************************************************
+ * @brief Enables interrupts globally.
+ ********************************************************************************/
+inline void GlobalInterruptEnable(void) { asm("SEI"); }
+
+/********************************************************************************
+ * @brief Disables interrupts globally.
+ ********************************************************************************/
+inline void GlobalInterruptDisable(void) { asm("CLI"); }
+
+/********************************************************************************
+ * @brief Saves the status register (holding the global interrupt flag) and
+ *        disables interrupts globally. Used together with GlobalInterruptRestore
+ *        to protect short critical sections without enabling interrupts in
+ *        contexts where they were disabled, e.g. in ISRs.
+ *
+ * @return
+ *        The content of the status register before interrupts were disabled.
+ ********************************************************************************/
+inline uint8_t GlobalInterruptSave(void) {
+    const uint8_t sreg{SREG};
+	asm volatile("CLI" ::: "memory");
+	return sreg;
+}
+
+/********************************************************************************
+ * @brief Restores the status register saved by GlobalInterruptSave, which
+ *        re-enables interrupts only if they were enabled before.
+ *
+ * @param sreg
+ *        The saved content of the status register.
+ ********************************************************************************/
+inline void GlobalInterruptRestore(const uint8_t sreg) {
+    asm volatile("" ::: "memory");
+    SREG = sreg;
+}
+
+/********************************************************************************
+ * @brief Calculates CRC-8 checksum (polynomial x^8 + x^2 + x + 1, i.e. 0x07)
+ *        of specified block of data. A previous checksum can be passed to
+ *        continue the calculation over several blocks.
+ *
+ * @param data
+ *        Pointer to the data to calculate the checksum of.
+ * @param size
+ *        The size of the data in bytes.
+ * @param crc
+ *        Start value of the checksum (default = 0).
+ * @return
+ *        The calculated checksum.
+ ********************************************************************************/
+inline uint8_t Crc8(const void* data, const size_t size, uint8_t crc = 0) {
+    const auto bytes{static_cast<const uint8_t*>(data)};
+	for (size_t i{}; i < size; ++i) {
+	    crc ^= bytes[i];
+		for (uint8_t j{}; j < 8; ++j) {
+		    crc = crc & 0x80 ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+		}
+	}
+	return crc;
+}
+
+/********************************************************************************
+ * @brief Calculates CRC-16 checksum (CCITT, polynomial x^16 + x^12 + x^5 + 1,
+ *        i.e. 0x1021) of specified block of data. A previous checksum can be
+ *        passed to continue the calculation over several blocks.
+ *
+ * @param data
+ *        Pointer to the data to calculate the checksum of.
+ * @param size
+ *        The size of the data in bytes.
+ * @param crc
+ *        Start value of the checksum (default = 0xFFFF).
+ * @return
+ *        The calculated checksum.
+ ********************************************************************************/
+inline uint16_t Crc16(const void* data, const size_t size, uint16_t crc = 0xFFFF) {
+    const auto bytes{static_cast<const uint8_t*>(data)};
+	for (size_t i{}; i < size; ++i) {
+	    crc ^= static_cast<uint16_t>(bytes[i] << 8);
+		for (uint8_t j{}; j < 8; ++j) {
+		    crc = crc & 0x8000 ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+		}
+	}
+	return crc;
+}
+
+/********************************************************************************
+ * @brief Rounds the specified number to the nearest integer.
+ *
+ * @param number
+ *        The number to round.
+ * @return
+ *        The corresponding rounded number.
+ ********************************************************************************/
+template <typename T1 = int32_t, typename T2 = double>
+constexpr T1 Round(const T2 value) {
+    static_assert(type_traits::is_integral<T1>::value && type_traits::is_arithmetic<T2>::value, 
+	              "Rounding only possible for arithmetic types!");
+    return static_cast<T1>(value + 0.5);
+}
+
+} /* namespace */
+} /* namespace utils */
+} /* namespace driver */
 } /* namespace yrgo */
\ No newline at end of file
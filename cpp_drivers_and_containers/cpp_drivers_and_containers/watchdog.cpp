@@ -1,79 +1,220 @@
-#include <watchdog.hpp>
-
-namespace yrgo {
-namespace driver {
-namespace watchdog {
-
-namespace {
-
-inline void ResetWatchdogInHardware(void) {
-    asm("WDR");
-}
-
-inline void ClearWatchdogResetFlag(void) {
-   utils::Clear(MCUSR, WDRF);
-}
-
-void (*callback)(void){nullptr};
-
-} /* namespace */
-
-void Init(const enum Timeout timeout_ms) {
-    utils::GlobalInterruptDisable();
-	utils::Set(WDTCSR, WDCE, WDE);
-	WDTCSR = static_cast<uint8_t>(timeout_ms);
-	utils::GlobalInterruptEnable();
-}
-
-void Reset(void) {
-    utils::GlobalInterruptDisable();
-	ResetWatchdogInHardware();
-	ClearWatchdogResetFlag();
-	utils::GlobalInterruptEnable();
-}
-
-void EnableSystemReset(void) {
-    Reset();
-	utils::GlobalInterruptDisable();
-	utils::Set(WDTCSR, WDCE, WDE);
-	utils::Set(WDTCSR, WDE);
-	utils::GlobalInterruptEnable();
-}
-
-void DisableSystemReset(void) {
-    Reset();
-    utils::GlobalInterruptDisable();
-    utils::Set(WDTCSR, WDCE, WDE);
-    utils::Clear(WDTCSR, WDE);
-    utils::GlobalInterruptEnable();
-}
-
-void EnableInterrupt(void (*callback_routine)(void)) {
-   Reset();
-   if (callback_routine) {
-       callback = callback_routine;
-   }
-   utils::GlobalInterruptDisable();
-   utils::Set(WDTCSR, WDCE, WDE);
-   utils::Set(WDTCSR, WDIE);
-   utils::GlobalInterruptEnable();
-}
-
-void DisableInterrupt(void) {
-   Reset();
-   utils::GlobalInterruptDisable();
-   utils::Set(WDTCSR, WDCE, WDE);
-   utils::Clear(WDTCSR, WDIE);
-   utils::GlobalInterruptEnable();
-}
-
-ISR (WDT_vect) {
-    EnableInterrupt();
-    if (callback) {
-        callback();
-    }
-}
-
-} /* namespace watchdog */
-} /* namespace driver */
-} /* namespace yrgo */
\ No newline at end of file
+#include <watchdog.hpp>
+
+/********************************************************************************
+ * @note The regular handler is entered from the naked interrupt vector, so it
+ *       needs the signal attribute for its prologue and epilogue. avr-gcc warns
+ *       about signal functions whose names don't start with __vector, hence the
+ *       name, which doesn't collide with any vector of the device.
+ ********************************************************************************/
+extern "C" void __vector_watchdog_handler(void) __attribute__((signal, used));
+
+namespace yrgo {
+namespace driver {
+namespace watchdog {
+
+namespace {
+
+/********************************************************************************
+ * @note Returns the content of the control register with WDIF masked, since
+ *       writing a one to WDIF clears a pending watchdog interrupt.
+ ********************************************************************************/
+inline uint8_t ControlRegister(void) {
+    return WDTCSR & ~(1 << WDIF);
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The timed sequence (WDCE and WDE set, then the new value within four
+ *           clock cycles) must not be interrupted, hence interrupts are disabled.
+ *           The previous interrupt state is restored afterwards instead of
+ *           enabling interrupts unconditionally, so the function can be called
+ *           from ISRs and other contexts with interrupts disabled.
+ *        2. The watchdog timer is reset first so that a shorter timeout doesn't
+ *           cause an immediate reset.
+ ********************************************************************************/
+void WriteControlRegister(const uint8_t value) {
+    const auto sreg{utils::GlobalInterruptSave()};
+	Feed();
+	WDTCSR = (1 << WDCE) | (1 << WDE);
+	WDTCSR = value;
+	utils::GlobalInterruptRestore(sreg);
+}
+
+void (*callback)(void){nullptr};
+
+struct Task {
+    uint16_t deadline_ms;
+    uint16_t elapsed_ms;
+};
+
+Task tasks[kMaxTasks]{};
+volatile bool checked_in[kMaxTasks]{};
+uint8_t num_tasks{};
+bool starved{false};
+
+/********************************************************************************
+ * @note The ID of a starved task is stored in the .noinit section, which isn't
+ *       cleared at startup and therefore survives a watchdog reset. The inverted
+ *       copy is used to reject random RAM contents after power-on.
+ ********************************************************************************/
+uint8_t starved_task __attribute__((section(".noinit")));
+uint8_t starved_task_inverted __attribute__((section(".noinit")));
+
+uint8_t LatchStarvedTask(void) {
+    const uint8_t task_id{static_cast<uint8_t>(starved_task) == 
+	                      static_cast<uint8_t>(~starved_task_inverted) ? starved_task : kNoTask};
+	starved_task = kNoTask;
+	starved_task_inverted = static_cast<uint8_t>(~kNoTask);
+	return task_id;
+}
+
+const uint8_t last_starved_task{LatchStarvedTask()};
+
+/********************************************************************************
+ * @note The return address of the watchdog interrupt (a word address) is stored
+ *       in the .noinit section by the watchdog interrupt vector when crash
+ *       capture is enabled. The inverted copy is only written after a capture.
+ ********************************************************************************/
+uint16_t crash_address __attribute__((section(".noinit")));
+uint16_t crash_address_inverted __attribute__((section(".noinit")));
+volatile bool crash_capture{false};
+
+uint16_t LatchCrashAddress(void) {
+    const uint16_t address{crash_address == static_cast<uint16_t>(~crash_address_inverted) ? 
+	                       crash_address : static_cast<uint16_t>(0)};
+	crash_address = 0;
+	crash_address_inverted = 0;
+	return address;
+}
+
+const uint16_t last_crash_address{LatchCrashAddress()};
+
+} /* namespace */
+
+void Init(const enum Timeout timeout_ms) {
+	WriteControlRegister(static_cast<uint8_t>(timeout_ms));
+}
+
+void Reset(void) {
+    Feed();
+}
+
+void EnableSystemReset(void) {
+	WriteControlRegister(ControlRegister() | (1 << WDE));
+}
+
+void DisableSystemReset(void) {
+	WriteControlRegister(ControlRegister() & ~(1 << WDE));
+}
+
+void EnableInterrupt(void (*callback_routine)(void)) {
+   if (callback_routine) {
+       callback = callback_routine;
+   }
+   WriteControlRegister(ControlRegister() | (1 << WDIE));
+}
+
+void DisableInterrupt(void) {
+   WriteControlRegister(ControlRegister() & ~(1 << WDIE));
+}
+
+bool RegisterTask(const uint16_t deadline_ms, uint8_t& task_id) {
+    if (num_tasks >= kMaxTasks || deadline_ms == 0) return false;
+	tasks[num_tasks] = {deadline_ms, 0};
+	checked_in[num_tasks] = true;
+	task_id = num_tasks++;
+	return true;
+}
+
+void CheckIn(const uint8_t task_id) {
+    if (task_id < kMaxTasks) {
+	    checked_in[task_id] = true;
+	}
+}
+
+void Supervise(const uint16_t elapsed_ms) {
+    if (starved) return;
+	for (uint8_t i{}; i < num_tasks; ++i) {
+	    if (checked_in[i]) {
+		    checked_in[i] = false;
+			tasks[i].elapsed_ms = 0;
+		} else if (tasks[i].deadline_ms - tasks[i].elapsed_ms > elapsed_ms) {
+		    tasks[i].elapsed_ms += elapsed_ms;
+		} else {
+		    starved_task = i;
+			starved_task_inverted = static_cast<uint8_t>(~i);
+			starved = true;
+			return;
+		}
+	}
+	Feed();
+}
+
+uint8_t LastStarvedTask(void) {
+    return last_starved_task;
+}
+
+void EnableCrashCapture(void) {
+	crash_capture = true;
+	WriteControlRegister(ControlRegister() | (1 << WDE) | (1 << WDIE));
+}
+
+uint16_t LastCrashAddress(void) {
+    return last_crash_address * 2;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The interrupt vector is naked, so the stack pointer still points
+ *           just below the return address pushed when the interrupt occurred.
+ *           After saving r0, r30 and r31, the return address (high byte first)
+ *           is located at SP + 4 and SP + 5.
+ *        2. The return address is copied to crash_address without affecting
+ *           SREG, then the saved registers are restored and the regular
+ *           handler is entered with all registers intact.
+ ********************************************************************************/
+ISR (WDT_vect, ISR_NAKED) {
+    asm volatile(
+	    "push r0                      \n\t"
+		"push r30                     \n\t"
+		"push r31                     \n\t"
+		"in   r30, __SP_L__           \n\t"
+		"in   r31, __SP_H__           \n\t"
+		"ldd  r0, Z+4                 \n\t"
+		"sts  %[address] + 1, r0      \n\t"
+		"ldd  r0, Z+5                 \n\t"
+		"sts  %[address], r0          \n\t"
+		"pop  r31                     \n\t"
+		"pop  r30                     \n\t"
+		"pop  r0                      \n\t"
+		"%~jmp __vector_watchdog_handler \n\t"
+		:: [address] "i" (&crash_address));
+}
+
+} /* namespace watchdog */
+} /* namespace driver */
+} /* namespace yrgo */
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. In crash capture mode, the captured return address is validated by
+ *           storing its inverted copy. The callback routine (if any) is called
+ *           as last words, then the handler waits for the system reset, which
+ *           occurs at the next timeout since the hardware has cleared WDIE.
+ *        2. Else the watchdog interrupt is re-enabled and the callback routine
+ *           is called (interrupt mode).
+ ********************************************************************************/
+void __vector_watchdog_handler(void) {
+    using namespace yrgo::driver::watchdog;
+	if (crash_capture) {
+	    crash_address_inverted = static_cast<uint16_t>(~crash_address);
+		if (callback) {
+		    callback();
+		}
+		while (1);
+	}
+    EnableInterrupt();
+    if (callback) {
+        callback();
+    }
+}
\ No newline at end of file
@@ -1,75 +1,164 @@
-/********************************************************************************
- * @brief Contains functions for using the ATmega328P watchdog timer.
- ********************************************************************************/
-#pragma once
-
-#include <utils.hpp>
-
-namespace yrgo {
-namespace driver {
-namespace watchdog {
-
-/********************************************************************************
- * @brief Enum class for selecting the timeout of the watchdog timer.
- ********************************************************************************/
-enum class Timeout {
-    k16ms = 0,                                         /* 16 ms */
-	k32ms = (1 << WDP0),                               /* 32 ms */
-	k64ms = (1 << WDP1),                               /* 64 ms */
-	k128ms = (1 << WDP1) | (1 << WDP0),                /* 128 ms */
-	k256ms = (1 << WDP2),                              /* 256 ms */
-	k512ms = (1 << WDP2) | (1 << WDP0),                /* 512 ms */
-	k1024ms = (1 << WDP2) | (1 << WDP1),               /* 1024 ms */
-	k2048ms = (1 << WDP2) | (1 << WDP1) | (1 << WDP0), /* 2048 ms */
-	k4096ms = (1 << WDP3),                             /* 4096 ms */
-	k8192ms = (1 << WDP3) | (1 << WDP0)                /* 8192 ms */
-};
-
-/********************************************************************************
- * @brief Initializes the watchdog timer and sets the selected timeout.
- *
- * @param timeout
- *        The timeout of the watchdog timer passed as an enumerator of the
- *        Timeout enum class.
- ********************************************************************************/
-void Init(const enum Timeout timeout);
-
-/********************************************************************************
- * @brief Resets the watchdog timer. This function must be called before the
- *        watchdog timer elapses, else the system will be reset (or a watchdog
- *        interrupt will be generated, depending on the selected mode of the
- *        watchdog timer).
- ********************************************************************************/
-void Reset(void);
-
-/********************************************************************************
- * @brief Enables system reset so that the system will be reset if the watchdog
- *        timer elapses, which occurs if the watchdog timer isn't reset in time.
- ********************************************************************************/
-void EnableSystemReset(void);
-
-/********************************************************************************
- * @brief Disables system reset so that the system won't be reset even if the
- *        watchdog timer elapses.
- ********************************************************************************/
-void DisableSystemReset(void);
-
-/********************************************************************************
- * @brief Enables watchdog timer interrupt so that an interrupt will occur if
- *        if he watchdog timer elapses, which occurs if isn't reset in time.
- *
- * @param callback_routine
- *        Function pointer to the callback routine to call when the watchdog 
- *        timer elapses (default = nullptr).
- ********************************************************************************/
-void EnableInterrupt(void (*callback_routine)(void) = nullptr);
-
-/********************************************************************************
- * @brief Disables watchdog timer interrupt so that no interrupt will occur
- *        if the watchdog timer elapses.
- ********************************************************************************/
-void DisableInterrupt(void);
-
-} /* namespace watchdog */
-} /* namespace driver */
+/********************************************************************************
+ * @brief Contains functions for using the ATmega328P watchdog timer.
+ ********************************************************************************/
+#pragma once
+
+#include <utils.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace watchdog {
+
+/********************************************************************************
+ * @brief Enum class for selecting the timeout of the watchdog timer.
+ ********************************************************************************/
+enum class Timeout {
+    k16ms = 0,                                         /* 16 ms */
+	k32ms = (1 << WDP0),                               /* 32 ms */
+	k64ms = (1 << WDP1),                               /* 64 ms */
+	k128ms = (1 << WDP1) | (1 << WDP0),                /* 128 ms */
+	k256ms = (1 << WDP2),                              /* 256 ms */
+	k512ms = (1 << WDP2) | (1 << WDP0),                /* 512 ms */
+	k1024ms = (1 << WDP2) | (1 << WDP1),               /* 1024 ms */
+	k2048ms = (1 << WDP2) | (1 << WDP1) | (1 << WDP0), /* 2048 ms */
+	k4096ms = (1 << WDP3),                             /* 4096 ms */
+	k8192ms = (1 << WDP3) | (1 << WDP0)                /* 8192 ms */
+};
+
+/********************************************************************************
+ * @brief Parameters for the task supervisor.
+ *
+ * @param kMaxTasks
+ *        The maximum number of tasks that can be supervised.
+ * @param kNoTask
+ *        Task ID indicating that no task is specified.
+ ********************************************************************************/
+static constexpr uint8_t kMaxTasks{8};
+static constexpr uint8_t kNoTask{0xFF};
+
+/********************************************************************************
+ * @brief Initializes the watchdog timer and sets the selected timeout.
+ *
+ * @param timeout
+ *        The timeout of the watchdog timer passed as an enumerator of the
+ *        Timeout enum class.
+ ********************************************************************************/
+void Init(const enum Timeout timeout);
+
+/********************************************************************************
+ * @brief Resets the watchdog timer. This function must be called before the
+ *        watchdog timer elapses, else the system will be reset (or a watchdog
+ *        interrupt will be generated, depending on the selected mode of the
+ *        watchdog timer).
+ ********************************************************************************/
+void Reset(void);
+
+/********************************************************************************
+ * @brief Resets the watchdog timer with a single WDR instruction. Unlike most
+ *        other functions of the watchdog timer, interrupts are never disabled,
+ *        so this function adds no latency to ISRs and can be used in tight loops
+ *        and from any context.
+ ********************************************************************************/
+inline void Feed(void) { asm volatile("WDR"); }
+
+/********************************************************************************
+ * @brief Enables system reset so that the system will be reset if the watchdog
+ *        timer elapses, which occurs if the watchdog timer isn't reset in time.
+ ********************************************************************************/
+void EnableSystemReset(void);
+
+/********************************************************************************
+ * @brief Disables system reset so that the system won't be reset even if the
+ *        watchdog timer elapses.
+ ********************************************************************************/
+void DisableSystemReset(void);
+
+/********************************************************************************
+ * @brief Enables watchdog timer interrupt so that an interrupt will occur if
+ *        if he watchdog timer elapses, which occurs if isn't reset in time.
+ *
+ * @param callback_routine
+ *        Function pointer to the callback routine to call when the watchdog 
+ *        timer elapses (default = nullptr).
+ ********************************************************************************/
+void EnableInterrupt(void (*callback_routine)(void) = nullptr);
+
+/********************************************************************************
+ * @brief Disables watchdog timer interrupt so that no interrupt will occur
+ *        if the watchdog timer elapses.
+ ********************************************************************************/
+void DisableInterrupt(void);
+
+/********************************************************************************
+ * @brief Registers a new task to be supervised. Each registered task must check
+ *        in via CheckIn before its deadline elapses, else the watchdog timer
+ *        isn't reset by Supervise and the system will be reset.
+ *
+ * @param deadline_ms
+ *        The maximum time between two check-ins in milliseconds.
+ * @param task_id
+ *        Reference to variable for storing the ID of the registered task.
+ * @return
+ *        True if the task was registered, false if kMaxTasks tasks are already
+ *        registered or the deadline is 0.
+ ********************************************************************************/
+bool RegisterTask(const uint16_t deadline_ms, uint8_t& task_id);
+
+/********************************************************************************
+ * @brief Indicates that specified task is alive. This function only performs a
+ *        single byte store and can be called from both tasks and ISRs.
+ *
+ * @param task_id
+ *        The ID of the task checking in.
+ ********************************************************************************/
+void CheckIn(const uint8_t task_id);
+
+/********************************************************************************
+ * @brief Advances the time of the supervisor and resets the watchdog timer if
+ *        every registered task has checked in before its deadline. If a task
+ *        has missed its deadline, the task ID is recorded and the watchdog timer
+ *        is no longer reset, so the system will be reset when it elapses. This
+ *        function should be called periodically, for instance from a timer
+ *        callback, with a period shorter than the watchdog timeout.
+ *
+ * @param elapsed_ms
+ *        The time elapsed since the last call in milliseconds.
+ ********************************************************************************/
+void Supervise(const uint16_t elapsed_ms);
+
+/********************************************************************************
+ * @brief Provides the ID of the task that missed its deadline and caused the
+ *        last system reset. The ID is preserved in RAM during the reset.
+ *
+ * @return
+ *        The ID of the starved task or kNoTask if the last reset wasn't caused
+ *        by a starved task.
+ ********************************************************************************/
+uint8_t LastStarvedTask(void);
+
+/********************************************************************************
+ * @brief Enables interrupt and system reset mode, in which a watchdog timeout
+ *        first generates an interrupt that captures the program counter of the
+ *        interrupted code and then resets the system at the next timeout. The
+ *        captured address is preserved in RAM during the reset.
+ *
+ * @note  The reset only occurs after the interrupt has been executed, so code
+ *        stuck with interrupts disabled (e.g. in an ISR) is never reset in this
+ *        mode. Use system reset mode to cover such faults.
+ ********************************************************************************/
+void EnableCrashCapture(void);
+
+/********************************************************************************
+ * @brief Provides the program address that was executing when the watchdog
+ *        timer elapsed in crash capture mode before the last system reset.
+ *        The address can be looked up in the listing (.lss) file.
+ *
+ * @return
+ *        The byte address of the interrupted instruction or 0 if no address
+ *        was captured before the last reset.
+ ********************************************************************************/
+uint16_t LastCrashAddress(void);
+
+} /* namespace watchdog */
+} /* namespace driver */
 } /* namespace yrgo */
\ No newline at end of file
@@ -0,0 +1,98 @@
+/********************************************************************************
+ * @brief Library implementing a small pseudo-random generator for the models.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class implementing a 32-bit xorshift generator, i.e. three shift-xor
+ *        operations per number, which is cheap on 8-bit targets too. Each model
+ *        owns its own generator, so models can be trained in parallel and the
+ *        state can be saved to resume training exactly.
+ ********************************************************************************/
+class Xorshift32 {
+  public:
+
+    /********************************************************************************
+     * @brief Creates unseeded generator, which is seeded via rand on first use.
+     ********************************************************************************/
+    Xorshift32(void) = default;
+
+    /********************************************************************************
+     * @brief Creates generator with specified seed.
+     *
+     * @param seed
+     *        The seed of the generator (0 is replaced by 1).
+     ********************************************************************************/
+    explicit Xorshift32(const uint32_t seed) { Seed(seed); }
+
+    /********************************************************************************
+     * @brief Seeds the generator, so the generated sequence is reproducible.
+     *
+     * @param seed
+     *        The seed of the generator (0 is replaced by 1, since the state
+     *        of a xorshift generator must never be 0).
+     ********************************************************************************/
+    void Seed(const uint32_t seed) { state_ = seed != 0 ? seed : 1; }
+
+    /********************************************************************************
+     * @brief Returns the current state of the generator (0 = unseeded).
+     ********************************************************************************/
+    uint32_t State(void) const { return state_; }
+
+    /********************************************************************************
+     * @brief Restores a state previously returned by State.
+     *
+     * @param state
+     *        The state to restore (0 = unseeded).
+     ********************************************************************************/
+    void SetState(const uint32_t state) { state_ = state; }
+
+    /********************************************************************************
+     * @brief Returns the next random number in the interval [0, max).
+     *
+     * @param max
+     *        The upper limit (exclusive) of the random number.
+     * @return
+     *        The generated random number.
+     ********************************************************************************/
+    uint32_t Next(const uint32_t max) {
+        if (state_ == 0) {
+            InitRandomGenerator();
+            state_ = (static_cast<uint32_t>(rand() & 0x7FFF) << 15) |
+                     static_cast<uint32_t>(rand() & 0x7FFF) | 1;
+        }
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_ % max;
+    }
+
+  /********************************************************************************
+   * @note The private segment is only visible internally (i.e. in this class).
+   ********************************************************************************/
+  private:
+
+    uint32_t state_{}; /* Generator state (0 = unseeded). */
+
+    /********************************************************************************
+     * @brief Initializes the rand function once with the current time, so an
+     *        unseeded generator gets a unique seed each time the program is run.
+     *        The seed is made by combining two 15-bit numbers from rand to a
+     *        30-bit seed, since RAND_MAX is guaranteed to be at least 32767.
+     ********************************************************************************/
+    static void InitRandomGenerator(void) {
+        static bool random_generator_initialized{false};
+        if (!random_generator_initialized) {
+            srand(time(nullptr));
+            random_generator_initialized = true;
+        }
+    }
+};
+
+} /* namespace yrgo */
\ No newline at end of file